@@ -0,0 +1,106 @@
+/// File: Arena.hxx
+/// @brief Provides an allocator drawing from the memory resource that is current on the calling
+///        thread, so that whole documents can be built in an arena and released in one piece.
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace FileParse
+{
+    namespace Detail
+    {
+        inline std::pmr::memory_resource *& currentArena()
+        {
+            thread_local std::pmr::memory_resource * arena{nullptr};
+            return arena;
+        }
+    }   // namespace Detail
+
+    /// Makes a memory resource the source of ArenaAllocator allocations on the current thread
+    /// while the scope is alive.
+    class ScopedArena
+    {
+    public:
+        /// @param arena The memory resource, or nullptr to allocate from the heap.
+        explicit ScopedArena(std::pmr::memory_resource * arena) :
+            previous_(std::exchange(Detail::currentArena(), arena))
+        {}
+
+        ~ScopedArena()
+        {
+            Detail::currentArena() = previous_;
+        }
+
+        ScopedArena(const ScopedArena &) = delete;
+        ScopedArena & operator=(const ScopedArena &) = delete;
+
+    private:
+        std::pmr::memory_resource * previous_;
+    };
+
+    /// Stateless allocator for containers that create their allocators on demand, such as
+    /// nlohmann::basic_json. Memory comes from the arena current on the allocating thread, or from
+    /// the heap if there is none. Each block records its source in a small header, so blocks of
+    /// different sources may be mixed in one container and freed from any thread. Freeing a block
+    /// of a monotonic arena does nothing; its memory is released with the arena.
+    /// @tparam T The type of the allocated objects.
+    template<typename T>
+    class ArenaAllocator
+    {
+    public:
+        using value_type = T;
+        using is_always_equal = std::true_type;
+
+        ArenaAllocator() noexcept = default;
+
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U> &) noexcept
+        {}
+
+        [[nodiscard]] T * allocate(size_t count)
+        {
+            static_assert(alignof(T) <= headerSize, "Over-aligned types are not supported");
+
+            auto * arena{Detail::currentArena()};
+            const auto bytes{headerSize + count * sizeof(T)};
+            auto * block{arena != nullptr ? arena->allocate(bytes, headerSize)
+                                          : ::operator new(bytes)};
+            ::new(block) Source{arena};
+            return static_cast<T *>(static_cast<void *>(static_cast<std::byte *>(block)
+                                                        + headerSize));
+        }
+
+        void deallocate(T * pointer, size_t count) noexcept
+        {
+            auto * block{static_cast<std::byte *>(static_cast<void *>(pointer)) - headerSize};
+            auto * arena{std::launder(reinterpret_cast<Source *>(block))->arena};
+            if(arena != nullptr)
+            {
+                arena->deallocate(block, headerSize + count * sizeof(T), headerSize);
+            }
+            else
+            {
+                ::operator delete(block);
+            }
+        }
+
+        template<typename U>
+        friend bool operator==(const ArenaAllocator &, const ArenaAllocator<U> &) noexcept
+        {
+            return true;
+        }
+
+    private:
+        struct Source
+        {
+            std::pmr::memory_resource * arena;
+        };
+
+        static constexpr size_t headerSize{alignof(std::max_align_t)};
+    };
+}   // namespace FileParse
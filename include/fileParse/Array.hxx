@@ -5,11 +5,13 @@
 #pragma once
 
 #include <array>
+#include <algorithm>
 #include <optional>
 #include <functional>
 #include <stdexcept>
 
 #include "Common.hxx"
+#include "Packed.hxx"
 
 namespace FileParse
 {
@@ -28,15 +30,90 @@ namespace FileParse
 
         auto currentNode{insertAllButLastChild(node, arr.nodeNames)};
 
-        for(const auto & item : arr.data)
+        if constexpr(std::is_same_v<T, double>)
         {
-            auto tableNode = currentNode.addChild(arr.nodeNames.back());
-            tableNode << item;
+            addDoubleChildNodes(currentNode, arr.nodeNames.back(), arr.data);
+        }
+        else
+        {
+            for(const auto & item : arr.data)
+            {
+                auto tableNode = currentNode.addChild(arr.nodeNames.back());
+                tableNode << item;
+            }
         }
 
         return node;
     }
 
+    /// Summary of decoding child nodes into a fixed size array.
+    struct ArrayDecodeStatus
+    {
+        /// Number of array elements assigned from child nodes.
+        size_t decoded{0};
+        /// Number of child nodes ignored because the array was already full.
+        size_t overflow{0};
+        /// Number of array elements left unchanged because there were not enough child nodes.
+        size_t underflow{0};
+    };
+
+    /// Decodes the child nodes named by the last node name directly into the array slots. Child
+    /// nodes beyond the size of the array are ignored and missing ones leave the array elements
+    /// unchanged.
+    /// @tparam NodeAdapter The type of the node adapter (e.g., XMLNodeAdapter, JSONNodeAdapter).
+    /// @tparam T The type of elements in the array.
+    /// @tparam N The size of the array.
+    /// @tparam Decoder Callable taking a child node and the array element to decode into.
+    /// @param node The parent node to deserialize from.
+    /// @param nodeNames The node path hierarchy of the elements.
+    /// @param arr The array where deserialized elements will be stored.
+    /// @param decoder Decodes a single child node into an array element.
+    /// @return The number of decoded, ignored and missing elements.
+    template<typename NodeAdapter, typename T, size_t N, typename Decoder>
+    ArrayDecodeStatus deserializeArray(const NodeAdapter & node,
+                                       const NodePath & nodeNames,
+                                       std::array<T, N> & arr,
+                                       Decoder decoder)
+    {
+        ArrayDecodeStatus status{0, 0, N};
+
+        if(nodeNames.empty())
+            return status;
+
+        if(auto currentNode{findParentOfLastTag(node, nodeNames)}; currentNode.has_value())
+        {
+            const auto childNodes{currentNode.value().getChildNodesByName(nodeNames.back())};
+
+            status.decoded = std::min(N, childNodes.size());
+            status.overflow = childNodes.size() - status.decoded;
+            status.underflow = N - status.decoded;
+
+            for(size_t i = 0u; i < status.decoded; ++i)
+            {
+                decoder(childNodes[i], arr[i]);
+            }
+        }
+
+        return status;
+    }
+
+    /// Decodes the child nodes named by the last node name directly into the array slots.
+    /// @tparam NodeAdapter The type of the node adapter (e.g., XMLNodeAdapter, JSONNodeAdapter).
+    /// @tparam T The type of elements in the array.
+    /// @tparam N The size of the array.
+    /// @param node The parent node to deserialize from.
+    /// @param nodeNames The node path hierarchy of the elements.
+    /// @param arr The array where deserialized elements will be stored.
+    /// @return The number of decoded, ignored and missing elements.
+    template<typename NodeAdapter, typename T, size_t N>
+    ArrayDecodeStatus deserializeArray(const NodeAdapter & node,
+                                       const NodePath & nodeNames,
+                                       std::array<T, N> & arr)
+    {
+        return deserializeArray(
+          node, nodeNames, arr, [](const NodeAdapter & childNode, T & item) { childNode >> item; });
+    }
+
     /// Deserializes child nodes into a std::array.
     /// @tparam NodeAdapter The type of the node adapter (e.g., XMLNodeAdapter, JSONNodeAdapter).
     /// @tparam T The type of elements in the array.
@@ -51,19 +128,7 @@ namespace FileParse
         if(!node.hasChildNode(arr.nodeNames.front()))
             return node;
 
-        if(auto currentNode{findParentOfLastTag(node, arr.nodeNames)}; currentNode.has_value())
-        {
-            const auto childNodes{currentNode.value().getChildNodesByName(arr.nodeNames.back())};
-
-            // std::array is fixed and cannot be resized, so we need to limit the number of elements
-            auto minimum{std::min(arr.data.size(), childNodes.size())};
-            for(int i = 0; i < minimum; ++i)
-            {
-                T item;
-                childNodes[i] >> item;
-                arr.data[i] = item;
-            }
-        }
+        deserializeArray(node, arr.nodeNames, arr.data);
 
         return node;
     }
@@ -108,10 +173,68 @@ namespace FileParse
         {
             auto currentNode{insertAllButLastChild(node, opt_vec.nodeNames)};
 
-            for(const auto & item : opt_vec.data.value())
+            if constexpr(std::is_same_v<T, double>)
             {
-                auto tableNode = currentNode.addChild(opt_vec.nodeNames.back());
-                tableNode << item;
+                addDoubleChildNodes(currentNode, opt_vec.nodeNames.back(), opt_vec.data.value());
+            }
+            else
+            {
+                for(const auto & item : opt_vec.data.value())
+                {
+                    auto tableNode = currentNode.addChild(opt_vec.nodeNames.back());
+                    tableNode << item;
+                }
+            }
+        }
+
+        return node;
+    }
+
+    /// Serializes a std::array of numbers packed into a single node.
+    /// @tparam NodeAdapter The type of the node adapter (e.g., XMLNodeAdapter, JSONNodeAdapter).
+    /// @tparam T The arithmetic type of elements in the array.
+    /// @tparam N The size of the array.
+    /// @param node The parent node to serialize the array into.
+    /// @param arr The Packed wrapper containing the array data and node path hierarchy.
+    /// @return Reference to the node (for chaining).
+    template<typename NodeAdapter, typename T, size_t N>
+    inline NodeAdapter & operator<<(NodeAdapter & node, const Packed<std::array<T, N>> & arr)
+    {
+        return serializePacked(node, arr.nodeNames, std::span<const T>{arr.data});
+    }
+
+    /// Serializes a std::array of numbers packed into a single node.
+    /// @tparam NodeAdapter The type of the node adapter (e.g., XMLNodeAdapter, JSONNodeAdapter).
+    /// @tparam T The arithmetic type of elements in the array.
+    /// @tparam N The size of the array.
+    /// @param node The parent node to serialize the array into.
+    /// @param arr The Packed wrapper containing the array data and node path hierarchy.
+    /// @return Reference to the node (for chaining).
+    template<typename NodeAdapter, typename T, size_t N>
+    inline NodeAdapter & operator<<(NodeAdapter & node, const Packed<const std::array<T, N>> & arr)
+    {
+        return serializePacked(node, arr.nodeNames, std::span<const T>{arr.data});
+    }
+
+    /// Deserializes numbers packed into a single node into a std::array. Values beyond the size
+    /// of the array are ignored and missing values leave the array elements unchanged, as does
+    /// malformed text reported to the active DiagnosticsSink.
+    /// @tparam NodeAdapter The type of the node adapter (e.g., XMLNodeAdapter, JSONNodeAdapter).
+    /// @tparam T The arithmetic type of elements in the array.
+    /// @tparam N The size of the array.
+    /// @param node The parent node to deserialize from.
+    /// @param arr The Packed wrapper where deserialized array data will be stored.
+    /// @return Const reference to the node (for chaining).
+    template<typename NodeAdapter, typename T, size_t N>
+    inline const NodeAdapter & operator>>(const NodeAdapter & node,
+                                          const Packed<std::array<T, N>> & arr)
+    {
+        if(const auto text{findPackedValues(node, arr.nodeNames)}; text.has_value())
+        {
+            DiagnosticsPathScope pathScope{arr.nodeNames.back()};
+            if(const auto values{parsePackedValuesOrReport<T>(text.value())}; values.has_value())
+            {
+                std::copy_n(values->begin(), std::min(N, values->size()), arr.data.begin());
             }
         }
 
@@ -123,19 +246,19 @@ namespace FileParse
     /// @tparam EnumType The enumeration type of the array elements.
     /// @tparam N The size of the array.
     /// @param node The parent node to serialize into.
-    /// @param tags Array of tag names specifying the node path hierarchy.
+    /// @param tags Tag names specifying the node path hierarchy.
     /// @param vec The array of enum values to serialize.
     /// @param converter Function that converts enum values to their string representation.
     /// @return Reference to the node (for chaining).
     template<typename NodeAdapter, typename EnumType, size_t N>
     NodeAdapter & serializeEnumVector(NodeAdapter & node,
-                                      const std::array<std::string, N> & tags,
+                                      const NodePath & tags,
                                       const std::array<EnumType, N> & vec,
                                       std::function<std::string(EnumType)> converter)
     {
         if(tags.empty())
         {
-            throw std::invalid_argument("Tag array is empty");
+            throw std::invalid_argument("Tag vector is empty");
         }
 
         auto currentNode{insertAllButLastChild(node, tags)};
@@ -150,42 +273,33 @@ namespace FileParse
     }
 
     /// Deserializes child nodes into an array of enum values, converting strings to enums.
+    /// Each child node is converted straight into its array slot; extra child nodes are ignored
+    /// and missing ones leave the array elements unchanged.
     /// @tparam NodeAdapter The type of the node adapter (e.g., XMLNodeAdapter, JSONNodeAdapter).
     /// @tparam EnumType The enumeration type of the array elements.
     /// @tparam N The size of the array.
     /// @param node The parent node to deserialize from.
-    /// @param tags Array of tag names specifying the node path hierarchy.
+    /// @param tags Tag names specifying the node path hierarchy.
     /// @param vec The array where deserialized enum values will be stored.
     /// @param converter Function that converts string representation to enum values.
-    /// @return Const reference to the node (for chaining).
+    /// @return The number of decoded, ignored and missing elements.
     template<typename NodeAdapter, typename EnumType, size_t N>
-    const NodeAdapter & deserializeEnumVector(const NodeAdapter & node,
-                                              const std::array<std::string, N> & tags,
-                                              std::array<EnumType, N> & vec,
-                                              std::function<EnumType(std::string_view)> converter)
+    ArrayDecodeStatus deserializeEnumVector(const NodeAdapter & node,
+                                            const NodePath & tags,
+                                            std::array<EnumType, N> & vec,
+                                            std::function<EnumType(std::string_view)> converter)
     {
         static_assert(std::is_enum_v<EnumType>, "Provided type is not an enum!");
 
         if(tags.empty())
         {
-            throw std::invalid_argument("Tag array is empty");
-        }
-
-        if(auto currentNode{findParentOfLastTag(node, tags)}; currentNode.has_value())
-        {
-            int totalNodes = currentNode.value().nChildNode(tags.back());
-            for(int i = 0; i < totalNodes; ++i)
-            {
-                NodeAdapter childNode = currentNode.value().getChildNode(tags.back(), i);
-                if(!childNode.isEmpty())
-                {
-                    const auto text = childNode.getText();
-                    vec.emplace_back(converter(text));
-                }
-            }
+            throw std::invalid_argument("Tag vector is empty");
         }
 
-        return node;
+        return deserializeArray(
+          node, tags, vec, [&converter](const NodeAdapter & childNode, EnumType & value) {
+              value = converter(childNode.getText());
+          });
     }
 
 }   // namespace FileParse
\ No newline at end of file
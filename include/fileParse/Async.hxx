@@ -0,0 +1,162 @@
+/// File: Async.hxx
+/// @brief Provides cancellation, executor submission and coroutine support for the asynchronous
+///        load and save functions.
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Scheduler.hxx"
+
+namespace FileParse
+{
+    /// Thrown from an asynchronous operation that stopped because it was cancelled.
+    class OperationCancelled : public std::runtime_error
+    {
+    public:
+        OperationCancelled() : std::runtime_error("Operation cancelled")
+        {}
+    };
+
+    /// Lets the caller cancel asynchronous operations. Copies share the same state, so the
+    /// caller keeps one copy and hands another one to the operation. Operations check the token
+    /// between their stages; a stage that already started runs to completion.
+    class CancellationToken
+    {
+    public:
+        CancellationToken() : cancelled_(std::make_shared<std::atomic<bool>>(false))
+        {}
+
+        /// Requests cancellation of all operations holding a copy of this token.
+        void cancel() noexcept
+        {
+            *cancelled_ = true;
+        }
+
+        /// @return True if cancellation was requested.
+        [[nodiscard]] bool isCancelled() const noexcept
+        {
+            return *cancelled_;
+        }
+
+        /// @throws OperationCancelled if cancellation was requested.
+        void throwIfCancelled() const
+        {
+            if(isCancelled())
+            {
+                throw OperationCancelled();
+            }
+        }
+
+    private:
+        std::shared_ptr<std::atomic<bool>> cancelled_;
+    };
+
+    /// Runs an operation on an executor.
+    /// @param executor The executor running the operation.
+    /// @param operation The operation. Its result or exception is stored in the future.
+    /// @return A future holding the result of the operation.
+    template<typename Operation>
+    [[nodiscard]] std::future<std::invoke_result_t<Operation &>> submit(Executor & executor,
+                                                                        Operation operation)
+    {
+        using Result = std::invoke_result_t<Operation &>;
+
+        // Executor tasks must be copyable, so the operation and the promise are shared
+        auto promise{std::make_shared<std::promise<Result>>()};
+        auto future{promise->get_future()};
+        executor.execute(
+          [promise, operation = std::make_shared<Operation>(std::move(operation))]() {
+              try
+              {
+                  if constexpr(std::is_void_v<Result>)
+                  {
+                      (*operation)();
+                      promise->set_value();
+                  }
+                  else
+                  {
+                      promise->set_value((*operation)());
+                  }
+              }
+              catch(...)
+              {
+                  promise->set_exception(std::current_exception());
+              }
+          });
+        return future;
+    }
+
+    /// Awaiter that runs an operation on an executor. The task running the operation resumes
+    /// the coroutine once the operation completed, so the coroutine continues on that executor
+    /// and no thread blocks while waiting. Operations awaited from a task of the same executor
+    /// therefore cannot deadlock it. The executor must outlive the operation.
+    /// @tparam T The type of the result of the operation.
+    template<typename T>
+    class OperationAwaiter
+    {
+    public:
+        OperationAwaiter(std::function<T()> operation, Executor & executor) :
+            operation_(std::move(operation)), executor_(executor)
+        {}
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            executor_.execute([this, handle]() {
+                try
+                {
+                    result_.emplace(operation_());
+                }
+                catch(...)
+                {
+                    error_ = std::current_exception();
+                }
+                handle.resume();
+            });
+        }
+
+        /// @return The result of the operation.
+        /// @throws The exception thrown by the operation.
+        T await_resume()
+        {
+            if(error_)
+            {
+                std::rethrow_exception(error_);
+            }
+            return std::move(result_.value());
+        }
+
+    private:
+        std::function<T()> operation_;
+        Executor & executor_;
+        std::optional<T> result_;
+        std::exception_ptr error_;
+    };
+
+    /// Makes an operation awaitable from a C++20 coroutine, e.g.
+    /// `auto sum = co_await FileParse::schedule([&] { return compute(); });`
+    /// @param operation The operation.
+    /// @param executor The executor running the operation and resuming the coroutine. Null
+    /// selects the default executor. It must outlive the operation.
+    /// @return The awaiter.
+    template<typename Operation>
+    [[nodiscard]] OperationAwaiter<std::invoke_result_t<Operation &>>
+      schedule(Operation operation, std::shared_ptr<Executor> executor = nullptr)
+    {
+        return {std::move(operation), executor ? *executor : *defaultExecutor()};
+    }
+}   // namespace FileParse
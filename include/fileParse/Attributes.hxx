@@ -8,6 +8,7 @@
 #include <functional>
 #include <optional>
 
+#include "Diagnostics.hxx"
 #include "StringConversion.hxx"
 
 namespace FileParse
@@ -87,7 +88,8 @@ namespace FileParse
 
         if(stringValue.has_value())
         {
-            attribute = FileParse::from_string<T>(stringValue.value());
+            DiagnosticsPathScope pathScope{name};
+            convertNumber(stringValue.value(), attribute);
         }
     }
 
@@ -230,7 +232,12 @@ namespace FileParse
         auto stringValue = node.getAttribute(name);
         if(stringValue.has_value())
         {
-            attribute = FileParse::from_string<T>(stringValue.value());
+            DiagnosticsPathScope pathScope{name};
+            T value{};
+            if(convertNumber(stringValue.value(), value))
+            {
+                attribute = value;
+            }
         }
     }
 
@@ -4,14 +4,20 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
 #include <map>
 #include <unordered_map>
 #include <array>
 #include <vector>
 
+#include "Diagnostics.hxx"
 #include "Formatter.hxx"
+#include "NodePath.hxx"
 
 namespace FileParse
 {
@@ -87,11 +93,10 @@ namespace FileParse
 
     /// Inserts all child nodes as specified by nodeNames into the given node.
     /// @param node The node to insert child nodes into.
-    /// @param nodeNames A vector of strings representing the names of the child nodes to be
-    /// inserted.
+    /// @param nodeNames The names of the child nodes to be inserted.
     /// @return The last inserted child node.
     template<typename NodeAdapter>
-    NodeAdapter insertAllChilds(NodeAdapter & node, const std::vector<std::string> & nodeNames)
+    NodeAdapter insertAllChilds(NodeAdapter & node, const NodePath & nodeNames)
     {
         NodeAdapter lastNode = node;
         for(const auto & nodeName : nodeNames)
@@ -105,12 +110,10 @@ namespace FileParse
 
     /// Inserts all but the last child node specified by nodeNames into the given node.
     /// @param node The node to insert child nodes into.
-    /// @param nodeNames A vector of strings representing the names of the child nodes to be
-    /// inserted, except the last one.
+    /// @param nodeNames The names of the child nodes to be inserted, except the last one.
     /// @return The second to last inserted child node.
     template<typename NodeAdapter>
-    NodeAdapter insertAllButLastChild(NodeAdapter & node,
-                                      const std::vector<std::string> & nodeNames)
+    NodeAdapter insertAllButLastChild(NodeAdapter & node, const NodePath & nodeNames)
     {
         NodeAdapter secondToLastNode = node;
         for(size_t i = 0; i < nodeNames.size() - 1; ++i)
@@ -123,11 +126,10 @@ namespace FileParse
 
     /// Finds the last tag in a sequence of nested tags specified by nodeNames.
     /// @param node The root node to start the search from.
-    /// @param nodeNames A vector of strings representing the nested tag names to search for.
+    /// @param nodeNames The nested tag names to search for.
     /// @return An optional containing the last node if found, or std::nullopt otherwise.
     template<typename NodeAdapter>
-    std::optional<NodeAdapter> findLastTag(NodeAdapter & node,
-                                           const std::vector<std::string> & nodeNames)
+    std::optional<NodeAdapter> findLastTag(NodeAdapter & node, const NodePath & nodeNames)
     {
         NodeAdapter currentNode = node;
 
@@ -145,12 +147,11 @@ namespace FileParse
 
     /// Finds the parent node of the last tag in a sequence of nested tags specified by nodeNames.
     /// @param node The root node to start the search from.
-    /// @param nodeNames A vector of strings representing the nested tag names to search for.
+    /// @param nodeNames The nested tag names to search for.
     /// @return An optional containing the parent of the last node if found, or std::nullopt
     /// otherwise.
     template<typename NodeAdapter>
-    std::optional<NodeAdapter> findParentOfLastTag(NodeAdapter node,
-                                                   const std::vector<std::string> & nodeNames)
+    std::optional<NodeAdapter> findParentOfLastTag(NodeAdapter node, const NodePath & nodeNames)
     {
         std::optional<NodeAdapter> currentNode = node;
 
@@ -169,11 +170,10 @@ namespace FileParse
 
     /// Counts the number of child nodes under the last tag in a sequence specified by nodeNames.
     /// @param node The root node to start the search from.
-    /// @param nodeNames A vector of strings representing the nested tag names to count the children
-    /// of.
+    /// @param nodeNames The nested tag names to count the children of.
     /// @return The number of child nodes under the last tag.
     template<typename NodeAdapter>
-    int numberOfChilds(NodeAdapter & node, const std::vector<std::string> & nodeNames)
+    int numberOfChilds(NodeAdapter & node, const NodePath & nodeNames)
     {
         auto currentNode{findParentOfLastTag(node, nodeNames)};
 
@@ -207,6 +207,33 @@ namespace FileParse
         return node;
     }
 
+    /// Inserts a string with a custom allocator, such as std::pmr::string, into the node as text.
+    /// @param node The node to insert text into.
+    /// @param text The string text to be inserted.
+    /// @return Reference to the updated node.
+    template<typename NodeAdapter, typename Allocator>
+    inline NodeAdapter &
+      operator<<(NodeAdapter & node,
+                 const std::basic_string<char, std::char_traits<char>, Allocator> & text)
+    {
+        node.addText(text);
+        return node;
+    }
+
+    /// Extracts text from the node into a string with a custom allocator. The string keeps its
+    /// allocator.
+    /// @param node The node to extract text from.
+    /// @param text String variable where the extracted text will be stored.
+    /// @return Const reference to the node.
+    template<typename NodeAdapter, typename Allocator>
+    inline const NodeAdapter &
+      operator>>(const NodeAdapter & node,
+                 std::basic_string<char, std::char_traits<char>, Allocator> & text)
+    {
+        text.assign(node.getText());
+        return node;
+    }
+
     /// Inserts a boolean value into the node as text ("true" or "false").
     /// @param node The node to insert the boolean text into.
     /// @param value The boolean value to be inserted.
@@ -241,7 +268,8 @@ namespace FileParse
         return node;
     }
 
-    /// Extracts text from the node and converts it to an integer value.
+    /// Extracts text from the node and converts it to an integer value. Malformed text throws, or
+    /// is reported to the active DiagnosticsSink and leaves the value unchanged.
     /// @param node The node to extract text from.
     /// @param value Integer variable where the extracted value will be stored.
     /// @return Const reference to the node.
@@ -249,7 +277,7 @@ namespace FileParse
     inline const NodeAdapter & operator>>(const NodeAdapter & node, int & value)
     {
         const auto text{node.getText()};
-        value = std::stoi(text);
+        convertNumber(text, value);
         return node;
     }
 
@@ -268,7 +296,8 @@ namespace FileParse
         return node;
     }
 
-    /// Extracts text from the node and converts it to a double value.
+    /// Extracts text from the node and converts it to a double value. Malformed text throws, or
+    /// is reported to the active DiagnosticsSink and leaves the value unchanged.
     /// @param node The node to extract text from.
     /// @param value Double variable where the extracted value will be stored.
     /// @return Const reference to the node.
@@ -276,10 +305,35 @@ namespace FileParse
     inline const NodeAdapter & operator>>(const NodeAdapter & node, double & value)
     {
         const auto text{node.getText()};
-        value = std::stod(text);
+        convertNumber(text, value);
         return node;
     }
 
+    /// Adds one child node per double value. All values are formatted through a single text
+    /// buffer that is reused for every child instead of a new string per value.
+    /// @param parent The node the child nodes are added to.
+    /// @param nodeName The name of the child nodes.
+    /// @param values The double values to be inserted.
+    template<typename NodeAdapter>
+    void addDoubleChildNodes(NodeAdapter & parent,
+                             std::string_view nodeName,
+                             std::span<const double> values)
+    {
+        const auto & config{SerializationConfig::getInstance()};
+
+        std::string text;
+        for(const auto value : values)
+        {
+            text.clear();
+            FileParse::appendFormattedDouble(text,
+                                             value,
+                                             config.precision,
+                                             config.scientificLowerBound,
+                                             config.scientificUpperBound);
+            parent.addChild(nodeName).addText(text);
+        }
+    }
+
     /// Inserts a size_t (unsigned integer) value into the node as text.
     /// @param node The node to insert the size_t value into.
     /// @param value The size_t value to be inserted.
@@ -291,7 +345,8 @@ namespace FileParse
         return node;
     }
 
-    /// Extracts text from the node and converts it to a size_t (unsigned integer) value.
+    /// Extracts text from the node and converts it to a size_t (unsigned integer) value. Malformed
+    /// text throws, or is reported to the active DiagnosticsSink and leaves the value unchanged.
     /// @param node The node to extract text from.
     /// @param value size_t variable where the extracted value will be stored.
     /// @return Const reference to the node.
@@ -299,7 +354,7 @@ namespace FileParse
     inline const NodeAdapter & operator>>(const NodeAdapter & node, size_t & value)
     {
         const auto text{node.getText()};
-        value = std::stoul(text);
+        convertNumber(text, value);
         return node;
     }
 
@@ -309,20 +364,70 @@ namespace FileParse
     struct is_valid_map : std::false_type
     {};
 
-    /// Specialization of is_valid_map for std::map.
+    /// Specialization of is_valid_map for std::map, including std::pmr::map.
     /// @tparam K The key type of the map.
     /// @tparam V The value type of the map.
-    template<typename K, typename V>
-    struct is_valid_map<std::map<K, V>> : std::true_type
+    /// @tparam Compare The comparison type of the map.
+    /// @tparam Allocator The allocator type of the map.
+    template<typename K, typename V, typename Compare, typename Allocator>
+    struct is_valid_map<std::map<K, V, Compare, Allocator>> : std::true_type
     {};
 
-    /// Specialization of is_valid_map for std::unordered_map.
+    /// Specialization of is_valid_map for std::unordered_map, including std::pmr::unordered_map.
     /// @tparam K The key type of the map.
     /// @tparam V The value type of the map.
-    template<typename K, typename V>
-    struct is_valid_map<std::unordered_map<K, V>> : std::true_type
+    /// @tparam Hash The hash type of the map.
+    /// @tparam KeyEqual The key equality type of the map.
+    /// @tparam Allocator The allocator type of the map.
+    template<typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+    struct is_valid_map<std::unordered_map<K, V, Hash, KeyEqual, Allocator>> : std::true_type
+    {};
+
+    /// Checks if a given container type can pre-allocate storage through reserve().
+    /// @tparam T The type to be checked.
+    template<typename T, typename = void>
+    struct has_reserve : std::false_type
     {};
 
+    /// Specialization of has_reserve for containers such as std::vector and std::unordered_map.
+    /// @tparam T The container type.
+    template<typename T>
+    struct has_reserve<T, std::void_t<decltype(std::declval<T &>().reserve(size_t{}))>>
+        : std::true_type
+    {};
+
+    /// Pre-sizes the container for the given number of additional elements. Containers without
+    /// reserve() (std::map, std::set) are left untouched.
+    /// @tparam Container The type of the container.
+    /// @param container The container to be pre-sized.
+    /// @param count The number of elements that are about to be inserted.
+    template<typename Container>
+    void reserveAdditional(Container & container, size_t count)
+    {
+        if constexpr(has_reserve<Container>::value)
+        {
+            container.reserve(container.size() + count);
+        }
+    }
+
+    namespace Detail
+    {
+        /// Creates an element that is about to be inserted into a container. Elements using
+        /// allocators, such as std::pmr::string, get the allocator of the container, so the whole
+        /// decoded structure comes from the memory resource of the outermost container and moving
+        /// the element into the container does not copy it.
+        /// @tparam T The type of the element.
+        /// @param container The container the element is inserted into.
+        /// @param args Arguments of the element constructor.
+        /// @return The new element.
+        template<typename T, typename Container, typename... Args>
+        T makeElement(const Container & container, Args &&... args)
+        {
+            return std::make_obj_using_allocator<T>(container.get_allocator(),
+                                                    std::forward<Args>(args)...);
+        }
+    }   // namespace Detail
+
     /// Inserts a map into the node by iterating over its key-value pairs.
     /// @param node The node to insert the map into.
     /// @param map The map to be inserted.
@@ -349,13 +454,14 @@ namespace FileParse
       operator>>(const NodeAdapter & node, MapType & map)
     {
         const auto & childNodes{node.getChildNodes()};
+        reserveAdditional(map, childNodes.size());
         for(const auto & childNode : childNodes)
         {
-            std::string key = childNode.getCurrentTag();
-
-            typename MapType::mapped_type val;
+            auto val{Detail::makeElement<typename MapType::mapped_type>(map)};
             childNode >> val;
-            map[key] = val;
+            map.insert_or_assign(
+              Detail::makeElement<typename MapType::key_type>(map, childNode.getCurrentTag()),
+              std::move(val));
         }
 
         return node;
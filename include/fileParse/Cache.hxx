@@ -0,0 +1,179 @@
+/// File: Cache.hxx
+/// @brief Provides a thread-safe least recently used cache bounded by the size of its entries.
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace FileParse
+{
+    /// Counters describing the use of a cache.
+    struct CacheStats
+    {
+        /// Number of lookups that found a valid entry.
+        size_t hits{0u};
+        /// Number of lookups that found no entry or a stale one.
+        size_t misses{0u};
+        /// Number of entries removed to make room for new ones.
+        size_t evictions{0u};
+        /// Number of entries currently held.
+        size_t entries{0u};
+        /// Summed size of the entries currently held.
+        size_t bytes{0u};
+    };
+
+    /// Cache keeping shared immutable values up to a total size. When an insertion exceeds the
+    /// size, the least recently used entries are evicted. Values handed out stay valid after
+    /// their entry is evicted. All member functions may be called concurrently.
+    /// @tparam Key The type of the keys. Must be hashable with std::hash.
+    /// @tparam Value The type of the cached values.
+    template<typename Key, typename Value>
+    class LruCache
+    {
+    public:
+        /// @param maxBytes The maximum summed size of the entries.
+        explicit LruCache(size_t maxBytes) : maxBytes_(maxBytes)
+        {}
+
+        LruCache(const LruCache &) = delete;
+        LruCache & operator=(const LruCache &) = delete;
+
+        /// Looks up a value and marks it as most recently used.
+        /// @param key The key of the value.
+        /// @param isValid Predicate deciding whether a found value is still current. A stale value
+        /// is removed and the lookup counts as a miss.
+        /// @return The value, or nullptr if there is no valid entry for the key.
+        template<typename Predicate>
+        [[nodiscard]] std::shared_ptr<const Value> find(const Key & key, Predicate && isValid)
+        {
+            std::scoped_lock lock{mutex_};
+
+            const auto it{index_.find(key)};
+            if(it == index_.end())
+            {
+                ++stats_.misses;
+                return nullptr;
+            }
+
+            if(!isValid(*it->second->value))
+            {
+                removeEntry(it);
+                ++stats_.misses;
+                return nullptr;
+            }
+
+            entries_.splice(entries_.begin(), entries_, it->second);
+            ++stats_.hits;
+            return it->second->value;
+        }
+
+        /// Looks up a value and marks it as most recently used.
+        /// @param key The key of the value.
+        /// @return The value, or nullptr if there is no entry for the key.
+        [[nodiscard]] std::shared_ptr<const Value> find(const Key & key)
+        {
+            return find(key, [](const Value &) { return true; });
+        }
+
+        /// Inserts or replaces a value and evicts least recently used entries until everything
+        /// fits. A value larger than the whole cache is not stored.
+        /// @param key The key of the value.
+        /// @param value The value to store.
+        /// @param bytes The size accounted for the value.
+        void insert(const Key & key, std::shared_ptr<const Value> value, size_t bytes)
+        {
+            std::scoped_lock lock{mutex_};
+
+            if(const auto it{index_.find(key)}; it != index_.end())
+            {
+                removeEntry(it);
+            }
+
+            if(bytes > maxBytes_)
+            {
+                return;
+            }
+
+            while(stats_.bytes + bytes > maxBytes_ && !entries_.empty())
+            {
+                removeEntry(index_.find(entries_.back().key));
+                ++stats_.evictions;
+            }
+
+            entries_.push_front(Entry{key, std::move(value), bytes});
+            index_.emplace(key, entries_.begin());
+            stats_.bytes += bytes;
+            stats_.entries = entries_.size();
+        }
+
+        /// Removes the entries whose keys match a predicate.
+        /// @param matches Predicate called with every key.
+        /// @return The number of removed entries.
+        template<typename Predicate>
+        size_t eraseIf(Predicate && matches)
+        {
+            std::scoped_lock lock{mutex_};
+
+            size_t removed{0u};
+            for(auto it = index_.begin(); it != index_.end();)
+            {
+                if(matches(it->first))
+                {
+                    it = removeEntry(it);
+                    ++removed;
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+            return removed;
+        }
+
+        /// Removes all entries. The counters of hits, misses and evictions are kept.
+        void clear()
+        {
+            std::scoped_lock lock{mutex_};
+            entries_.clear();
+            index_.clear();
+            stats_.bytes = 0u;
+            stats_.entries = 0u;
+        }
+
+        /// @return The current counters.
+        [[nodiscard]] CacheStats stats() const
+        {
+            std::scoped_lock lock{mutex_};
+            return stats_;
+        }
+
+    private:
+        struct Entry
+        {
+            Key key;
+            std::shared_ptr<const Value> value;
+            size_t bytes;
+        };
+
+        using Index = std::unordered_map<Key, typename std::list<Entry>::iterator>;
+
+        typename Index::iterator removeEntry(typename Index::iterator it)
+        {
+            stats_.bytes -= it->second->bytes;
+            entries_.erase(it->second);
+            stats_.entries = entries_.size();
+            return index_.erase(it);
+        }
+
+        mutable std::mutex mutex_;
+        std::list<Entry> entries_;
+        Index index_;
+        size_t maxBytes_;
+        CacheStats stats_;
+    };
+}   // namespace FileParse
@@ -5,19 +5,23 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Base.hxx"
 
 namespace FileParse
 {
-    /// Represents a child node for parsing or serialization, along with associated data.
+    /// Represents a child node for parsing or serialization, along with associated data. The node
+    /// names are not copied, so a Child must not outlive the strings naming its nodes. It is
+    /// meant to be used as a temporary, as in node >> Child{"Name", value}; names held by a
+    /// temporary std::string or vector are rejected at compile time.
     /// @tparam T The type of the data associated with the child node.
     template<typename T>
     struct Child
     {
         /// Names of the nodes in the hierarchy leading to the child.
-        std::vector<std::string> nodeNames;
+        NodePath nodeNames;
 
         /// Reference to the data associated with the child node.
         T & data;
@@ -25,30 +29,18 @@ namespace FileParse
         /// Index of the child node among siblings (default 0).
         size_t index{0u};
 
-
-        /// Constructs a Child object with a single node name.
-        /// @param nodeName The name of the child node.
-        /// @param data Reference to the data associated with the node.
-        /// @param index Optional index of the child node (default 0).
-        Child(const std::string & nodeName, T & data, size_t index = 0u) :
-            nodeNames({nodeName}), data(data), index(index)
-        {}
-
-        /// Constructs a Child object with an initializer list of node names.
-        /// @param nodeNames Initializer list of strings representing node names.
+        /// Constructs a Child object from a single node name, an initializer list of node names
+        /// or a vector of node names.
+        /// @param nodeNames The names of the nodes leading to the child.
         /// @param data Reference to the data associated with the node.
         /// @param index Optional index of the child node (default 0).
-        Child(std::initializer_list<std::string> nodeNames, T & data, size_t index = 0u) :
-            nodeNames(nodeNames), data(data), index(index)
+        Child(NodePath nodeNames, T & data, size_t index = 0u) :
+            nodeNames(std::move(nodeNames)), data(data), index(index)
         {}
 
-        /// Constructs a Child object with a vector of node names.
-        /// @param nodeNames Vector of strings representing node names.
-        /// @param data Reference to the data associated with the node.
-        /// @param index Optional index of the child node (default 0).
-        Child(const std::vector<std::string> & nodeNames, T & data, size_t index = 0u) :
-            nodeNames(nodeNames), data(data), index(index)
-        {}
+        template<typename Names>
+            requires owns_node_names_v<Names>
+        Child(Names && nodeNames, T & data, size_t index = 0u) = delete;
     };
 
     /// Inserts data associated with a Child object into the corresponding node hierarchy.
@@ -84,6 +76,7 @@ namespace FileParse
             auto childNode{node.getFirstChildByName(nodeName)};
             if(childNode.has_value())
             {
+                DiagnosticsPathScope pathScope{nodeName};
                 childNode.value() >> child.data;
             }
         }
@@ -0,0 +1,270 @@
+/// File: Diagnostics.hxx
+/// @brief Provides a sink collecting conversion failures while decoding, so that a malformed value
+///        keeps the default of its field instead of aborting the whole load with an exception.
+
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "StringConversion.hxx"
+
+namespace FileParse
+{
+    /// A value that could not be converted.
+    struct Diagnostic
+    {
+        /// Names of the nodes leading to the value, separated by '/'.
+        std::string nodePath;
+        /// The text that could not be converted.
+        std::string text;
+        /// Why the text could not be converted.
+        std::string message;
+    };
+
+    /// Collects the conversion failures reported while a ScopedDiagnostics is active. A sink may
+    /// be shared by scopes on several threads.
+    class DiagnosticsSink
+    {
+    public:
+        /// Records a conversion failure.
+        /// @param diagnostic The failure to record.
+        void report(Diagnostic diagnostic)
+        {
+            std::scoped_lock lock{mutex_};
+            diagnostics_.push_back(std::move(diagnostic));
+        }
+
+        /// @return A copy of the recorded failures in the order they were reported.
+        [[nodiscard]] std::vector<Diagnostic> diagnostics() const
+        {
+            std::scoped_lock lock{mutex_};
+            return diagnostics_;
+        }
+
+        /// @return The number of recorded failures.
+        [[nodiscard]] size_t size() const
+        {
+            std::scoped_lock lock{mutex_};
+            return diagnostics_.size();
+        }
+
+        [[nodiscard]] bool empty() const
+        {
+            return size() == 0u;
+        }
+
+        void clear()
+        {
+            std::scoped_lock lock{mutex_};
+            diagnostics_.clear();
+        }
+
+    private:
+        mutable std::mutex mutex_;
+        std::vector<Diagnostic> diagnostics_;
+    };
+
+    namespace Detail
+    {
+        /// Diagnostics state of the decoding running on the current thread.
+        struct DiagnosticsContext
+        {
+            DiagnosticsSink * sink{nullptr};
+            std::vector<std::string_view> path;
+            /// Whether the path is tracked to find where a decode failed, see ScopedFailurePath.
+            bool trackFailure{false};
+            /// Path of the innermost node left by an exception while failures are tracked.
+            std::string failurePath;
+        };
+
+        inline DiagnosticsContext & diagnosticsContext()
+        {
+            thread_local DiagnosticsContext context;
+            return context;
+        }
+
+        inline std::string currentNodePath()
+        {
+            std::string path;
+            for(const auto name : diagnosticsContext().path)
+            {
+                if(!path.empty())
+                {
+                    path += '/';
+                }
+                path += name;
+            }
+            return path;
+        }
+    }   // namespace Detail
+
+    /// Routes conversion failures of the decoding on the current thread into a sink while the
+    /// scope is alive. Malformed numbers and enumerators then leave their field unchanged instead
+    /// of throwing. Decoding spread over worker threads, e.g. by ParallelChild, is not covered.
+    class ScopedDiagnostics
+    {
+    public:
+        /// @param sink The sink receiving the failures.
+        /// @param rootName Name prepended to the node paths, usually the name of the top node.
+        explicit ScopedDiagnostics(DiagnosticsSink & sink, std::string rootName = {}) :
+            rootName_(std::move(rootName)),
+            previousSink_(std::exchange(Detail::diagnosticsContext().sink, &sink)),
+            previousPath_(std::move(Detail::diagnosticsContext().path))
+        {
+            Detail::diagnosticsContext().path.clear();
+            if(!rootName_.empty())
+            {
+                Detail::diagnosticsContext().path.push_back(rootName_);
+            }
+        }
+
+        ~ScopedDiagnostics()
+        {
+            Detail::diagnosticsContext().sink = previousSink_;
+            Detail::diagnosticsContext().path = std::move(previousPath_);
+        }
+
+        ScopedDiagnostics(const ScopedDiagnostics &) = delete;
+        ScopedDiagnostics & operator=(const ScopedDiagnostics &) = delete;
+
+    private:
+        std::string rootName_;
+        DiagnosticsSink * previousSink_;
+        std::vector<std::string_view> previousPath_;
+    };
+
+    /// Adds a node name to the paths of the diagnostics reported while the scope is alive. Does
+    /// nothing if neither a sink is active nor failures are tracked.
+    class DiagnosticsPathScope
+    {
+    public:
+        /// @param name The node name. Must outlive the scope.
+        explicit DiagnosticsPathScope(std::string_view name) :
+            active_(Detail::diagnosticsContext().sink != nullptr
+                    || Detail::diagnosticsContext().trackFailure),
+            uncaughtExceptions_(std::uncaught_exceptions())
+        {
+            if(active_)
+            {
+                Detail::diagnosticsContext().path.push_back(name);
+            }
+        }
+
+        ~DiagnosticsPathScope()
+        {
+            if(active_)
+            {
+                auto & context{Detail::diagnosticsContext()};
+                if(context.trackFailure && context.failurePath.empty()
+                   && std::uncaught_exceptions() > uncaughtExceptions_)
+                {
+                    context.failurePath = Detail::currentNodePath();
+                }
+                context.path.pop_back();
+            }
+        }
+
+        DiagnosticsPathScope(const DiagnosticsPathScope &) = delete;
+        DiagnosticsPathScope & operator=(const DiagnosticsPathScope &) = delete;
+
+    private:
+        bool active_;
+        int uncaughtExceptions_;
+    };
+
+    namespace Detail
+    {
+        /// Tracks the node path of the decoding on the current thread while the scope is alive, so
+        /// that the innermost node left by an exception can be reported.
+        class ScopedFailurePath
+        {
+        public:
+            /// @param rootName Name prepended to the node path, usually the name of the top node.
+            explicit ScopedFailurePath(std::string rootName) :
+                rootName_(std::move(rootName)),
+                previousTracking_(std::exchange(diagnosticsContext().trackFailure, true)),
+                previousPath_(std::move(diagnosticsContext().path)),
+                previousFailurePath_(std::move(diagnosticsContext().failurePath))
+            {
+                diagnosticsContext().path.assign(1u, rootName_);
+                diagnosticsContext().failurePath.clear();
+            }
+
+            ~ScopedFailurePath()
+            {
+                auto & context{diagnosticsContext()};
+                context.trackFailure = previousTracking_;
+                context.path = std::move(previousPath_);
+                context.failurePath = std::move(previousFailurePath_);
+            }
+
+            ScopedFailurePath(const ScopedFailurePath &) = delete;
+            ScopedFailurePath & operator=(const ScopedFailurePath &) = delete;
+
+            /// @return Path of the innermost node left by an exception, or the root name if the
+            ///         exception was thrown outside of any child node.
+            [[nodiscard]] std::string failurePath() const
+            {
+                const auto & path{diagnosticsContext().failurePath};
+                return path.empty() ? rootName_ : path;
+            }
+
+        private:
+            std::string rootName_;
+            bool previousTracking_;
+            std::vector<std::string_view> previousPath_;
+            std::string previousFailurePath_;
+        };
+    }   // namespace Detail
+
+    /// Reports a conversion failure to the sink of the current thread.
+    /// @param text The text that could not be converted.
+    /// @param message Why the text could not be converted.
+    /// @return False if no sink is active and the caller has to fail by itself.
+    inline bool reportConversionFailure(std::string_view text, std::string_view message)
+    {
+        auto * sink{Detail::diagnosticsContext().sink};
+        if(sink == nullptr)
+        {
+            return false;
+        }
+        sink->report({Detail::currentNodePath(), std::string(text), std::string(message)});
+        return true;
+    }
+
+    /// Converts text to a number with the grammar of FileParse::parseNumber, whether a sink is
+    /// active or not. A malformed text is reported to the active sink and leaves the value
+    /// unchanged; without a sink, it throws std::invalid_argument or std::out_of_range.
+    /// @param text The text to convert.
+    /// @param value Receives the number.
+    /// @return True if the value was converted.
+    template<typename T>
+    bool convertNumber(std::string_view text, T & value)
+    {
+        const auto error{parseNumber(text, value)};
+        if(error == std::errc{})
+        {
+            return true;
+        }
+
+        const auto * message{error == std::errc::result_out_of_range ? "Value out of range"
+                                                                     : "Invalid number"};
+        if(!reportConversionFailure(text, message))
+        {
+            if(error == std::errc::result_out_of_range)
+            {
+                throw std::out_of_range(std::string(message) + ": " + std::string(text));
+            }
+            throw std::invalid_argument(std::string(message) + ": " + std::string(text));
+        }
+        return false;
+    }
+}   // namespace FileParse
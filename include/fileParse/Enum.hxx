@@ -10,6 +10,8 @@
 #include <functional>
 #include <optional>
 
+#include "Diagnostics.hxx"
+
 namespace FileParse
 {
     /// Serializes an enumeration value to a node using a custom converter function.
@@ -32,7 +34,9 @@ namespace FileParse
         return node;
     }
 
-    /// Deserializes an enumeration value from a node using a custom converter function.
+    /// Deserializes an enumeration value from a node using a custom converter function. If the
+    /// converter throws while a DiagnosticsSink is active, the failure is reported and the value
+    /// is left unchanged.
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam EnumType The enumeration type to be deserialized.
     /// @param node The node to deserialize the enumeration value from.
@@ -47,7 +51,21 @@ namespace FileParse
     {
         static_assert(std::is_enum_v<EnumType>, "Provided type is not an enum!");
 
-        e = converter(node.getText());
+        const auto text{node.getText()};
+        if(Detail::diagnosticsContext().sink == nullptr)
+        {
+            e = converter(text);
+            return node;
+        }
+
+        try
+        {
+            e = converter(text);
+        }
+        catch(const std::exception & exception)
+        {
+            reportConversionFailure(text, exception.what());
+        }
 
         return node;
     }
@@ -0,0 +1,185 @@
+/// File: Expected.hxx
+/// @brief Provides a result type holding either a loaded value or a description of why loading
+///        failed, including the position of the failure in the source.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+namespace FileParse
+{
+    /// The stage at which loading failed.
+    enum class ErrorCategory
+    {
+        FileNotFound,
+        UnknownFormat,
+        Syntax,
+        MissingNode,
+        Decode
+    };
+
+    /// @param category The category to describe.
+    /// @return The name of the category.
+    [[nodiscard]] constexpr std::string_view toString(ErrorCategory category)
+    {
+        switch(category)
+        {
+            case ErrorCategory::FileNotFound:
+                return "FileNotFound";
+            case ErrorCategory::UnknownFormat:
+                return "UnknownFormat";
+            case ErrorCategory::Syntax:
+                return "Syntax";
+            case ErrorCategory::MissingNode:
+                return "MissingNode";
+            case ErrorCategory::Decode:
+                return "Decode";
+        }
+        return "Unknown";
+    }
+
+    /// Describes why loading failed. Positions are only set for syntax errors.
+    struct LoadError
+    {
+        ErrorCategory category{ErrorCategory::Syntax};
+        std::string message;
+        /// Zero based offset of the failing byte in the source.
+        size_t offset{0u};
+        /// One based line of the failing byte, or 0 if unknown.
+        size_t line{0u};
+        /// One based column of the failing byte, or 0 if unknown.
+        size_t column{0u};
+        /// Names of the nodes enclosing the failure, separated by '/'.
+        std::string nodePath;
+    };
+
+    /// Sets the line and column of an error from its offset.
+    /// @param error The error to update.
+    /// @param content The source the offset refers to.
+    inline void setLineAndColumn(LoadError & error, std::string_view content)
+    {
+        const auto end{std::min(error.offset, content.size())};
+
+        size_t lineStart{0u};
+        error.line = 1u;
+        for(size_t i = 0u; i < end; ++i)
+        {
+            if(content[i] == '\n')
+            {
+                ++error.line;
+                lineStart = i + 1u;
+            }
+        }
+        error.column = end - lineStart + 1u;
+    }
+
+    /// Sets the offset of an error from its line and column.
+    /// @param error The error to update.
+    /// @param content The source the line and column refer to.
+    inline void setOffset(LoadError & error, std::string_view content)
+    {
+        size_t lineStart{0u};
+        for(size_t line = 1u; line < error.line && lineStart < content.size(); ++line)
+        {
+            const auto newLine{content.find('\n', lineStart)};
+            lineStart = newLine == std::string_view::npos ? content.size() : newLine + 1u;
+        }
+        error.offset = std::min(lineStart + (error.column > 0u ? error.column - 1u : 0u),
+                                content.size());
+    }
+
+    /// Holds either a value or the error that prevented producing it. The member names follow
+    /// std::expected, so code can move to it once C++23 is available.
+    /// @tparam T The type of the value.
+    template<typename T>
+    class Expected
+    {
+    public:
+        Expected(T value) : state_(std::in_place_index<0u>, std::move(value))
+        {}
+
+        Expected(LoadError error) : state_(std::in_place_index<1u>, std::move(error))
+        {}
+
+        [[nodiscard]] bool has_value() const noexcept
+        {
+            return state_.index() == 0u;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return has_value();
+        }
+
+        /// @return The value.
+        /// @throws std::runtime_error with the error message if there is no value.
+        [[nodiscard]] T & value() &
+        {
+            throwIfError();
+            return std::get<0u>(state_);
+        }
+
+        [[nodiscard]] const T & value() const &
+        {
+            throwIfError();
+            return std::get<0u>(state_);
+        }
+
+        [[nodiscard]] T && value() &&
+        {
+            throwIfError();
+            return std::get<0u>(std::move(state_));
+        }
+
+        [[nodiscard]] T & operator*() &
+        {
+            return *std::get_if<0u>(&state_);
+        }
+
+        [[nodiscard]] const T & operator*() const &
+        {
+            return *std::get_if<0u>(&state_);
+        }
+
+        [[nodiscard]] T * operator->()
+        {
+            return std::get_if<0u>(&state_);
+        }
+
+        [[nodiscard]] const T * operator->() const
+        {
+            return std::get_if<0u>(&state_);
+        }
+
+        /// @param fallback The value returned if there is no value.
+        /// @return The value, or the fallback.
+        template<typename U>
+        [[nodiscard]] T value_or(U && fallback) const &
+        {
+            return has_value() ? std::get<0u>(state_) : static_cast<T>(std::forward<U>(fallback));
+        }
+
+        /// @return The error. Must only be called if there is no value.
+        [[nodiscard]] const LoadError & error() const &
+        {
+            return *std::get_if<1u>(&state_);
+        }
+
+    private:
+        void throwIfError() const
+        {
+            if(!has_value())
+            {
+                throw std::runtime_error(error().message);
+            }
+        }
+
+        std::variant<T, LoadError> state_;
+    };
+}   // namespace FileParse
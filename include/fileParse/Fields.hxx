@@ -0,0 +1,148 @@
+/// File: Fields.hxx
+/// @brief Provides compile-time descriptions of the fields of a structure, from which both
+///        serialization directions are generated instead of being written by hand.
+
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Common.hxx"
+#include "RecordPlan.hxx"
+
+namespace FileParse
+{
+    /// A member of a structure that is stored in a child node.
+    /// @tparam Class The type of the structure.
+    /// @tparam Member The type of the member.
+    template<typename Class, typename Member>
+    struct Field
+    {
+        using class_type = Class;
+        using member_type = Member;
+
+        /// Names of the nodes leading to the child node of the member.
+        NodePath nodeNames;
+
+        /// Pointer to the member.
+        Member Class::*member;
+    };
+
+    /// Describes a member stored in a child node.
+    /// @param nodeNames The names of the nodes leading to the child node of the member.
+    /// @param member Pointer to the member.
+    /// @return The field description.
+    template<typename Class, typename Member>
+    constexpr Field<Class, Member> field(NodePath nodeNames, Member Class::*member)
+    {
+        return {nodeNames, member};
+    }
+
+    /// Checks if the fields of a type are described, usually through FILEPARSE_FIELDS.
+    /// @tparam T The type to be checked.
+    template<typename T, typename = void>
+    struct has_fields : std::false_type
+    {};
+
+    /// Specialization of has_fields for types with a fileParseFields function found by
+    /// argument dependent lookup.
+    /// @tparam T The type with described fields.
+    template<typename T>
+    struct has_fields<T, std::void_t<decltype(fileParseFields(static_cast<const T *>(nullptr)))>>
+        : std::true_type
+    {};
+
+    /// @tparam T The type with described fields.
+    /// @return The tuple of Field descriptions of the type, in declaration order.
+    template<typename T>
+    constexpr auto fieldsOf()
+    {
+        static_assert(has_fields<T>::value, "The fields of the type are not described!");
+        return fileParseFields(static_cast<const T *>(nullptr));
+    }
+
+    /// Deserializes every described field of a structure from its child node. The child nodes
+    /// are visited once and dispatched to their fields through the RecordPlan of the type.
+    /// @tparam NodeAdapter The type of the node adapter.
+    /// @tparam T The type with described fields.
+    /// @param node The node to deserialize the structure from.
+    /// @param value The structure receiving the fields.
+    /// @return Const reference to the node.
+    template<typename NodeAdapter, typename T>
+    const NodeAdapter & deserializeFields(const NodeAdapter & node, T & value)
+    {
+        static_assert(has_fields<T>::value, "The fields of the type are not described!");
+        return recordPlan<T>().decode(node, value);
+    }
+
+    /// Serializes every described field of a structure into its child node.
+    /// @tparam NodeAdapter The type of the node adapter.
+    /// @tparam T The type with described fields.
+    /// @param node The node to serialize the structure into.
+    /// @param value The structure providing the fields.
+    /// @return Reference to the updated node.
+    template<typename NodeAdapter, typename T>
+    NodeAdapter & serializeFields(NodeAdapter & node, const T & value)
+    {
+        static constexpr auto fields{fieldsOf<T>()};
+        std::apply(
+          [&](const auto &... field) {
+              ((node << Child{field.nodeNames, value.*field.member}), ...);
+          },
+          fields);
+        return node;
+    }
+}   // namespace FileParse
+
+// Applies a macro to every argument, recursing through deferred expansion (up to 256 arguments)
+#define FILEPARSE_DETAIL_PARENS ()
+#define FILEPARSE_DETAIL_EXPAND(...)                                                              \
+    FILEPARSE_DETAIL_EXPAND3(FILEPARSE_DETAIL_EXPAND3(FILEPARSE_DETAIL_EXPAND3(                   \
+      FILEPARSE_DETAIL_EXPAND3(__VA_ARGS__))))
+#define FILEPARSE_DETAIL_EXPAND3(...)                                                             \
+    FILEPARSE_DETAIL_EXPAND2(FILEPARSE_DETAIL_EXPAND2(FILEPARSE_DETAIL_EXPAND2(                   \
+      FILEPARSE_DETAIL_EXPAND2(__VA_ARGS__))))
+#define FILEPARSE_DETAIL_EXPAND2(...)                                                             \
+    FILEPARSE_DETAIL_EXPAND1(FILEPARSE_DETAIL_EXPAND1(FILEPARSE_DETAIL_EXPAND1(                   \
+      FILEPARSE_DETAIL_EXPAND1(__VA_ARGS__))))
+#define FILEPARSE_DETAIL_EXPAND1(...) __VA_ARGS__
+#define FILEPARSE_DETAIL_FOR_EACH(macro, type, ...)                                               \
+    __VA_OPT__(FILEPARSE_DETAIL_EXPAND(FILEPARSE_DETAIL_FOR_EACH_HELPER(macro, type, __VA_ARGS__)))
+#define FILEPARSE_DETAIL_FOR_EACH_HELPER(macro, type, first, ...)                                 \
+    macro(type, first) __VA_OPT__(                                                                \
+      , FILEPARSE_DETAIL_FOR_EACH_AGAIN FILEPARSE_DETAIL_PARENS(macro, type, __VA_ARGS__))
+#define FILEPARSE_DETAIL_FOR_EACH_AGAIN() FILEPARSE_DETAIL_FOR_EACH_HELPER
+
+// Turns (member, "Tag") into the Field description of the member
+#define FILEPARSE_DETAIL_UNPAREN(...) __VA_ARGS__
+#define FILEPARSE_DETAIL_APPLY(macro, args) macro args
+#define FILEPARSE_DETAIL_FIELD(type, description)                                                 \
+    FILEPARSE_DETAIL_APPLY(FILEPARSE_DETAIL_MAKE_FIELD,                                           \
+                           (type, FILEPARSE_DETAIL_UNPAREN description))
+#define FILEPARSE_DETAIL_MAKE_FIELD(type, member, tag) ::FileParse::field(tag, &type::member)
+
+/// Describes the fields of a structure and generates its operator>> and operator<<. Each field is
+/// given as (member, "Tag"), the member being stored in the child node named Tag exactly as
+/// node >> Child{"Tag", value.member} would. Must be used at namespace scope in the namespace of
+/// the structure, so that the generated functions are found by argument dependent lookup:
+///
+///     FILEPARSE_FIELDS(Layer, (name, "Name"), (thickness, "Thickness"))
+#define FILEPARSE_FIELDS(Type, ...)                                                               \
+    [[maybe_unused]] constexpr auto fileParseFields(const Type *)                                 \
+    {                                                                                             \
+        return std::make_tuple(                                                                   \
+          FILEPARSE_DETAIL_FOR_EACH(FILEPARSE_DETAIL_FIELD, Type, __VA_ARGS__));                  \
+    }                                                                                             \
+                                                                                                  \
+    template<typename NodeAdapter>                                                                \
+    inline const NodeAdapter & operator>>(const NodeAdapter & node, Type & value)                 \
+    {                                                                                             \
+        return ::FileParse::deserializeFields(node, value);                                       \
+    }                                                                                             \
+                                                                                                  \
+    template<typename NodeAdapter>                                                                \
+    inline NodeAdapter & operator<<(NodeAdapter & node, const Type & value)                       \
+    {                                                                                             \
+        return ::FileParse::serializeFields(node, value);                                         \
+    }
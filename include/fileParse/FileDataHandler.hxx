@@ -4,15 +4,33 @@
 
 #pragma once
 
+#include <algorithm>
 #include <string>
+#include <cstdint>
 #include <fstream>
 #include <sstream>
 #include <optional>
 #include <variant>
+#include <vector>
+#include <span>
+#include <filesystem>
+#include <exception>
+#include <istream>
+#include <future>
+#include <typeindex>
+#include <typeinfo>
 
 #include "XMLNodeAdapter.hxx"
 #include "JSONNodeAdapter.hxx"
 #include "FileFormat.hxx"
+#include "FileWriter.hxx"
+#include "Parallel.hxx"
+#include "Pipeline.hxx"
+#include "Async.hxx"
+#include "Cache.hxx"
+#include "Hash.hxx"
+#include "Expected.hxx"
+#include "Diagnostics.hxx"
 
 /// Type alias for a node adapter that can hold either XML or JSON adapter.
 using NodeAdapter = std::variant<XMLNodeAdapter, JSONNodeAdapter>;
@@ -21,17 +39,251 @@ namespace Common
 {
     namespace
     {
-        /// Creates a file with the specified content.
+        /// Creates or atomically replaces a file with the specified content.
         /// @param fileName The name of the file to create.
         /// @param fileContent The content to write to the file.
-        void createFileFromString(std::string_view fileName, std::string_view fileContent)
+        /// @param sync Forces the content to the storage device before the file is replaced.
+        /// @return True if the whole content was written.
+        bool createFileFromString(std::string_view fileName,
+                                  std::string_view fileContent,
+                                  bool sync = false)
         {
-            std::ofstream out(fileName.data());
-            out << fileContent;
-            out.close();
+            return FileParse::writeFileAtomically(fileName, fileContent, sync);
+        }
+
+        /// Reads the whole content of a file.
+        /// @param fileName The name of the file to read.
+        /// @return The content of the file, or std::nullopt if the file cannot be opened.
+        std::optional<std::string> readFileToString(const std::string & fileName)
+        {
+            std::ifstream in(fileName, std::ios::binary);
+            if(!in.is_open())
+            {
+                return std::nullopt;
+            }
+
+            std::ostringstream content;
+            content << in.rdbuf();
+            return std::move(content).str();
         }
     }   // namespace
 
+    namespace Detail
+    {
+        /// Size and modification time of a file, used to detect changes of cached files.
+        struct FileStamp
+        {
+            std::uintmax_t size;
+            std::filesystem::file_time_type modified;
+
+            bool operator==(const FileStamp &) const = default;
+        };
+
+        /// Reads the size and modification time of a file.
+        /// @param path The path of the file.
+        /// @return The stamp, or std::nullopt if the file cannot be inspected.
+        inline std::optional<FileStamp> stampFile(const std::filesystem::path & path)
+        {
+            std::error_code sizeError;
+            std::error_code timeError;
+            FileStamp stamp{std::filesystem::file_size(path, sizeError),
+                            std::filesystem::last_write_time(path, timeError)};
+            if(sizeError || timeError)
+            {
+                return std::nullopt;
+            }
+            return stamp;
+        }
+
+        /// Builds the part of a cache key identifying a file. The path is terminated with a
+        /// character that cannot be part of it, so the prefix selects exactly the keys of one file.
+        /// @param path The path of the file. The existing part of it is resolved.
+        /// @return The key prefix.
+        inline std::string fileKeyPrefix(const std::filesystem::path & path)
+        {
+            std::error_code errorCode;
+            const auto resolved{std::filesystem::weakly_canonical(path, errorCode)};
+            return (errorCode ? path : resolved).string() + '\0';
+        }
+
+        /// Checks whether a file holds exactly the given content. The sizes are compared first,
+        /// then the file is read in chunks until the first difference.
+        /// @param fileName The name of the file.
+        /// @param content The expected content.
+        /// @return True if the file exists and its content is equal.
+        inline bool fileContentEquals(const std::string & fileName, std::string_view content)
+        {
+            std::error_code errorCode;
+            const auto size{std::filesystem::file_size(fileName, errorCode)};
+            if(errorCode || size != content.size())
+            {
+                return false;
+            }
+
+            std::ifstream in(fileName, std::ios::binary);
+            if(!in.is_open())
+            {
+                return false;
+            }
+
+            constexpr size_t chunkSize{size_t{64u} * 1024u};
+            std::string chunk(chunkSize, '\0');
+            for(size_t offset = 0u; offset < content.size(); offset += chunkSize)
+            {
+                const auto count{std::min(chunkSize, content.size() - offset)};
+                in.read(chunk.data(), static_cast<std::streamsize>(count));
+                if(static_cast<size_t>(in.gcount()) != count
+                   || content.compare(offset, count, chunk.data(), count) != 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }   // namespace Detail
+
+    /// Options of the load functions.
+    struct LoadOptions
+    {
+        /// Creates a file holding just the empty root element when the file does not exist.
+        /// Without it, loading a missing file fails without touching the file system.
+        bool createIfMissing{true};
+    };
+
+    namespace Detail
+    {
+        /// Removes a UTF-8 byte order mark, which the string parsers do not expect.
+        /// @param content The file content.
+        inline void stripByteOrderMark(std::string & content)
+        {
+            if(content.starts_with("\xEF\xBB\xBF"))
+            {
+                content.erase(0u, 3u);
+            }
+        }
+
+        /// Detects the format of a file from its extension, or else from its content.
+        /// @param fileName The name of the file.
+        /// @param content The content of the file, or at least its beginning.
+        /// @return The detected format.
+        inline FileParse::FileFormat detectFormat(std::string_view fileName,
+                                                  std::string_view content)
+        {
+            const auto format{FileParse::detectFileFormatFromExtension(fileName)};
+            return format != FileParse::FileFormat::Unknown
+                     ? format
+                     : FileParse::detectFormatFromStringContent(content);
+        }
+
+        /// Content of a file prepared for parsing.
+        struct FileContent
+        {
+            /// The content without a byte order mark.
+            std::string text;
+            /// The format detected from the extension, or else from the content.
+            FileParse::FileFormat format;
+        };
+
+        /// Reads a file, strips a byte order mark and detects its format. A missing file is
+        /// not created.
+        /// @param fileName The name of the file.
+        /// @return The prepared content, or std::nullopt if the file cannot be read.
+        inline std::optional<FileContent> readFileContent(std::string_view fileName)
+        {
+            auto content{readFileToString(std::string(fileName))};
+            if(!content.has_value())
+            {
+                return std::nullopt;
+            }
+            stripByteOrderMark(content.value());
+
+            const auto format{detectFormat(fileName, content.value())};
+            return FileContent{std::move(content.value()), format};
+        }
+
+        /// Parses the top node of prepared content.
+        /// @param content The prepared content.
+        /// @param topNodeName The name of the top node to retrieve.
+        /// @return The top node, or std::nullopt if the content cannot be parsed.
+        inline std::optional<NodeAdapter> parseTopNode(const FileContent & content,
+                                                       std::string_view topNodeName)
+        {
+            switch(content.format)
+            {
+                case FileParse::FileFormat::XML:
+                    if(auto node = getXMLTopNodeFromString(content.text, topNodeName))
+                    {
+                        return NodeAdapter{std::move(*node)};
+                    }
+                    break;
+                case FileParse::FileFormat::JSON:
+                    if(auto node = getJSONTopNodeFromString(content.text, topNodeName))
+                    {
+                        return NodeAdapter{std::move(*node)};
+                    }
+                    break;
+                default:
+                    break;
+            }
+            return std::nullopt;
+        }
+
+        /// Decodes an object from a top node of either format.
+        /// @tparam T The type of object to deserialize (must have operator>> defined).
+        /// @param node The top node.
+        /// @return The decoded object.
+        template<typename T>
+        T decodeTopNode(const NodeAdapter & node)
+        {
+            T model;
+            std::visit([&model](const auto & adapter) { adapter >> model; }, node);
+            return model;
+        }
+    }   // namespace Detail
+
+    /// Options of the save functions.
+    struct SaveOptions
+    {
+        /// Leaves the file untouched if it already holds exactly the serialized content, so
+        /// file watchers and synchronization tools see no change.
+        bool skipUnchanged{false};
+        /// Forces the content to the storage device before the file is replaced. Files are
+        /// always replaced atomically, this additionally makes the new content survive a crash
+        /// of the machine.
+        bool sync{false};
+    };
+
+    /// Result of a save function called with SaveOptions.
+    struct SaveResult
+    {
+        /// 0 on success, -1 if the format cannot be determined, other non-zero on write failure.
+        int status{0};
+        /// True if the file was written, false if it was skipped or the save failed.
+        bool written{false};
+    };
+
+    namespace Detail
+    {
+        /// Writes serialized content to a file unless the options allow to skip an unchanged
+        /// file.
+        /// @param content The serialized content.
+        /// @param fileName The name of the file.
+        /// @param options The save options.
+        /// @return The status and whether the file was written.
+        inline SaveResult writeContent(std::string_view content,
+                                       const std::string & fileName,
+                                       const SaveOptions & options)
+        {
+            if(options.skipUnchanged && fileContentEquals(fileName, content))
+            {
+                return {0, false};
+            }
+
+            const bool written{createFileFromString(fileName, content, options.sync)};
+            return {written ? 0 : 1, written};
+        }
+    }   // namespace Detail
+
     //////////////////////////////////////////////////////////////////////////
     // XML Functions
     //////////////////////////////////////////////////////////////////////////
@@ -86,6 +338,32 @@ namespace Common
         return std::nullopt;
     }
 
+    /// Deserializes an object from an XML file that is opened and read once.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param fileName The path to the XML file.
+    /// @param nodeTypeName The name of the root XML element.
+    /// @param options Whether a missing file is created with an empty root element.
+    /// @return An optional containing the deserialized object, or std::nullopt on failure.
+    template<typename T>
+    std::optional<T> loadFromXMLFile(std::string_view fileName,
+                                     const std::string & nodeTypeName,
+                                     const LoadOptions & options)
+    {
+        auto content{readFileToString(std::string(fileName))};
+        if(!content.has_value())
+        {
+            if(!options.createIfMissing)
+            {
+                return std::nullopt;
+            }
+            content = "<" + nodeTypeName + ">\n</" + nodeTypeName + ">";
+            createFileFromString(fileName, content.value());
+        }
+
+        Detail::stripByteOrderMark(content.value());
+        return loadFromXMLString<T>(content.value(), nodeTypeName);
+    }
+
     /// Serializes an object to an XML file.
     /// @tparam T The type of object to serialize (must have operator<< defined).
     /// @param object The object to serialize.
@@ -117,6 +395,23 @@ namespace Common
         return node.getContent();
     }
 
+    /// Serializes an object to an XML file. The file receives the content of saveToXMLString.
+    /// @tparam T The type of object to serialize (must have operator<< defined).
+    /// @param object The object to serialize.
+    /// @param fileName The path to the output XML file.
+    /// @param nodeName The name of the root XML element.
+    /// @param options Options such as skipping the write of unchanged content.
+    /// @return The status and whether the file was written.
+    template<typename T>
+    SaveResult saveToXMLFile(const T & object,
+                             std::string_view fileName,
+                             const std::string & nodeName,
+                             const SaveOptions & options)
+    {
+        return Detail::writeContent(
+          saveToXMLString(object, nodeName), std::string(fileName), options);
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // JSON Functions
     //////////////////////////////////////////////////////////////////////////
@@ -170,6 +465,32 @@ namespace Common
         return std::nullopt;
     }
 
+    /// Deserializes an object from a JSON file that is opened and read once.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param fileName The path to the JSON file.
+    /// @param nodeTypeName The name of the root JSON property.
+    /// @param options Whether a missing file is created with an empty root property.
+    /// @return An optional containing the deserialized object, or std::nullopt on failure.
+    template<typename T>
+    std::optional<T> loadFromJSONFile(std::string_view fileName,
+                                      const std::string & nodeTypeName,
+                                      const LoadOptions & options)
+    {
+        auto content{readFileToString(std::string(fileName))};
+        if(!content.has_value())
+        {
+            if(!options.createIfMissing)
+            {
+                return std::nullopt;
+            }
+            content = "{\"" + nodeTypeName + "\": {}}";
+            createFileFromString(fileName, content.value());
+        }
+
+        Detail::stripByteOrderMark(content.value());
+        return loadFromJSONString<T>(content.value(), nodeTypeName);
+    }
+
     /// Serializes an object to a JSON file.
     /// @tparam T The type of object to serialize (must have operator<< defined).
     /// @param object The object to serialize.
@@ -201,6 +522,23 @@ namespace Common
         return node.getContent();
     }
 
+    /// Serializes an object to a JSON file. The file receives the content of saveToJSONString.
+    /// @tparam T The type of object to serialize (must have operator<< defined).
+    /// @param object The object to serialize.
+    /// @param fileName The path to the output JSON file.
+    /// @param nodeName The name of the root JSON property.
+    /// @param options Options such as skipping the write of unchanged content.
+    /// @return The status and whether the file was written.
+    template<typename T>
+    SaveResult saveToJSONFile(const T & object,
+                              std::string_view fileName,
+                              const std::string & nodeName,
+                              const SaveOptions & options)
+    {
+        return Detail::writeContent(
+          saveToJSONString(object, nodeName), std::string(fileName), options);
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Unified Functions (Auto-detect format)
     //////////////////////////////////////////////////////////////////////////
@@ -293,6 +631,39 @@ namespace Common
         }
     }
 
+    /// Deserializes an object from a file that is opened and read once. The format is detected
+    /// from the extension, or else from the content.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param fileName The path to the file.
+    /// @param nodeTypeName The name of the root element/property.
+    /// @param options Whether a missing file is created. Files without a known extension are
+    /// never created since their format is unknown.
+    /// @return An optional containing the deserialized object, or std::nullopt on failure.
+    template<typename T>
+    std::optional<T> loadFromFile(std::string_view fileName,
+                                  const std::string & nodeTypeName,
+                                  const LoadOptions & options)
+    {
+        using namespace FileParse;
+
+        switch(detectFileFormatFromExtension(fileName))
+        {
+            case FileFormat::XML:
+                return loadFromXMLFile<T>(fileName, nodeTypeName, options);
+            case FileFormat::JSON:
+                return loadFromJSONFile<T>(fileName, nodeTypeName, options);
+            default:
+                break;
+        }
+
+        const auto content{Detail::readFileContent(fileName)};
+        if(!content.has_value())
+        {
+            return std::nullopt;
+        }
+        return loadFromString<T>(content->text, nodeTypeName, content->format);
+    }
+
     /// Serializes an object to a file, automatically detecting format from extension.
     /// @tparam T The type of object to serialize (must have operator<< defined).
     /// @param object The object to serialize.
@@ -317,6 +688,200 @@ namespace Common
         }
     }
 
+    /// Serializes an object to a file, automatically detecting format from extension.
+    /// @tparam T The type of object to serialize (must have operator<< defined).
+    /// @param object The object to serialize.
+    /// @param fileName The path to the output file (format detected from extension).
+    /// @param nodeName The name of the root element/property.
+    /// @param options Options such as skipping the write of unchanged content.
+    /// @return The status and whether the file was written.
+    template<typename T>
+    SaveResult saveToFile(const T & object,
+                          std::string_view fileName,
+                          const std::string & nodeName,
+                          const SaveOptions & options)
+    {
+        using namespace FileParse;
+
+        switch(detectFileFormatFromExtension(fileName))
+        {
+            case FileFormat::XML:
+                return saveToXMLFile(object, fileName, nodeName, options);
+            case FileFormat::JSON:
+                return saveToJSONFile(object, fileName, nodeName, options);
+            default:
+                return {-1, false};
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Error Reporting Functions
+    //////////////////////////////////////////////////////////////////////////
+
+    namespace Detail
+    {
+        /// Decodes an object from a parsed top node. Only a failing decode throws, so the
+        /// exception handling costs nothing for valid input.
+        template<typename T, typename Adapter>
+        FileParse::Expected<T> tryDecode(const Adapter & node, const std::string & nodeTypeName)
+        {
+            const FileParse::Detail::ScopedFailurePath failurePath{nodeTypeName};
+            try
+            {
+                T object{};
+                node >> object;
+                return object;
+            }
+            catch(const std::exception & exception)
+            {
+                FileParse::LoadError error;
+                error.category = FileParse::ErrorCategory::Decode;
+                error.message = exception.what();
+                error.nodePath = failurePath.failurePath();
+                return error;
+            }
+        }
+
+        /// @param fileName The file that could not be read.
+        /// @return The error reported for a missing or unreadable file.
+        inline FileParse::LoadError fileNotFound(std::string_view fileName)
+        {
+            FileParse::LoadError error;
+            error.category = FileParse::ErrorCategory::FileNotFound;
+            error.message = "Cannot open file " + std::string(fileName);
+            return error;
+        }
+    }   // namespace Detail
+
+    /// Deserializes an object from an XML string and describes why that failed.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param data The XML string to parse.
+    /// @param nodeTypeName The name of the root XML element.
+    /// @return The deserialized object, or the error with its category, position and node path.
+    template<typename T>
+    FileParse::Expected<T> tryLoadFromXMLString(const std::string & data,
+                                                const std::string & nodeTypeName)
+    {
+        const auto node{tryGetXMLTopNodeFromString(data, nodeTypeName)};
+        if(!node)
+        {
+            return node.error();
+        }
+        return Detail::tryDecode<T>(*node, nodeTypeName);
+    }
+
+    /// Deserializes an object from a JSON string and describes why that failed.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param data The JSON string to parse.
+    /// @param nodeTypeName The name of the root JSON property.
+    /// @return The deserialized object, or the error with its category, position and node path.
+    template<typename T>
+    FileParse::Expected<T> tryLoadFromJSONString(const std::string & data,
+                                                 const std::string & nodeTypeName)
+    {
+        const auto node{tryGetJSONTopNodeFromString(data, nodeTypeName)};
+        if(!node)
+        {
+            return node.error();
+        }
+        return Detail::tryDecode<T>(*node, nodeTypeName);
+    }
+
+    /// Deserializes an object from a string with explicit format specification and describes
+    /// why that failed.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param data The string to parse.
+    /// @param nodeTypeName The name of the root element/property.
+    /// @param format The file format (XML or JSON).
+    /// @return The deserialized object, or the error with its category, position and node path.
+    template<typename T>
+    FileParse::Expected<T> tryLoadFromString(const std::string & data,
+                                             const std::string & nodeTypeName,
+                                             FileParse::FileFormat format)
+    {
+        switch(format)
+        {
+            case FileParse::FileFormat::XML:
+                return tryLoadFromXMLString<T>(data, nodeTypeName);
+            case FileParse::FileFormat::JSON:
+                return tryLoadFromJSONString<T>(data, nodeTypeName);
+            default:
+                return FileParse::LoadError{
+                  FileParse::ErrorCategory::UnknownFormat, "Unknown format", 0u, 0u, 0u, {}};
+        }
+    }
+
+    /// Deserializes an object from a string, detecting the format from the content, and
+    /// describes why that failed.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param data The string to parse.
+    /// @param nodeTypeName The name of the root element/property.
+    /// @return The deserialized object, or the error with its category, position and node path.
+    template<typename T>
+    FileParse::Expected<T> tryLoadFromString(const std::string & data,
+                                             const std::string & nodeTypeName)
+    {
+        return tryLoadFromString<T>(
+          data, nodeTypeName, FileParse::detectFormatFromStringContent(data));
+    }
+
+    /// Deserializes an object from an XML file and describes why that failed. The file is read
+    /// once and a missing file is not created.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param fileName The path to the XML file.
+    /// @param nodeTypeName The name of the root XML element.
+    /// @return The deserialized object, or the error with its category, position and node path.
+    template<typename T>
+    FileParse::Expected<T> tryLoadFromXMLFile(std::string_view fileName,
+                                              const std::string & nodeTypeName)
+    {
+        auto content{readFileToString(std::string(fileName))};
+        if(!content.has_value())
+        {
+            return Detail::fileNotFound(fileName);
+        }
+        Detail::stripByteOrderMark(content.value());
+        return tryLoadFromXMLString<T>(content.value(), nodeTypeName);
+    }
+
+    /// Deserializes an object from a JSON file and describes why that failed. The file is read
+    /// once and a missing file is not created.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param fileName The path to the JSON file.
+    /// @param nodeTypeName The name of the root JSON property.
+    /// @return The deserialized object, or the error with its category, position and node path.
+    template<typename T>
+    FileParse::Expected<T> tryLoadFromJSONFile(std::string_view fileName,
+                                               const std::string & nodeTypeName)
+    {
+        auto content{readFileToString(std::string(fileName))};
+        if(!content.has_value())
+        {
+            return Detail::fileNotFound(fileName);
+        }
+        Detail::stripByteOrderMark(content.value());
+        return tryLoadFromJSONString<T>(content.value(), nodeTypeName);
+    }
+
+    /// Deserializes an object from a file and describes why that failed. The format is detected
+    /// from the extension, or else from the content. The file is read once and a missing file is
+    /// not created.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param fileName The path to the file.
+    /// @param nodeTypeName The name of the root element/property.
+    /// @return The deserialized object, or the error with its category, position and node path.
+    template<typename T>
+    FileParse::Expected<T> tryLoadFromFile(std::string_view fileName,
+                                           const std::string & nodeTypeName)
+    {
+        const auto content{Detail::readFileContent(fileName)};
+        if(!content.has_value())
+        {
+            return Detail::fileNotFound(fileName);
+        }
+        return tryLoadFromString<T>(content->text, nodeTypeName, content->format);
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Unified Node Adapter Functions
     //////////////////////////////////////////////////////////////////////////
@@ -396,4 +961,600 @@ namespace Common
         return std::nullopt;
     }
 
-}   // namespace Common
\ No newline at end of file
+    //////////////////////////////////////////////////////////////////////////
+    // Document Cache
+    //////////////////////////////////////////////////////////////////////////
+
+    /// Keeps parsed documents in memory, so files that are read over and over are parsed once.
+    /// Entries are looked up by canonical path and top node name and are only used while the
+    /// size and modification time of the file are unchanged. The size of a file is accounted as
+    /// the size of its entry. Concurrent lookups of a file that is not cached yet may parse it
+    /// more than once; the last parsed document is kept.
+    class DocumentCache
+    {
+    public:
+        /// @param maxBytes The maximum summed size of the cached files.
+        explicit DocumentCache(size_t maxBytes = size_t{256u} * 1024u * 1024u) :
+            documents_(maxBytes)
+        {}
+
+        /// Retrieves the top-level node from a file, parsing it only if the cached document is
+        /// missing or outdated. The format is detected like in getTopNodeFromFile.
+        /// @param fileName The name of the file containing the data.
+        /// @param topNodeName The name of the top node to retrieve.
+        /// @return Shared read-only node, or nullptr if the file cannot be loaded. Its const
+        /// methods may be called from multiple threads.
+        [[nodiscard]] std::shared_ptr<const NodeAdapter>
+          getTopNodeFromFile(std::string_view fileName, std::string_view topNodeName)
+        {
+            std::error_code errorCode;
+            const auto path{std::filesystem::canonical(std::filesystem::path(fileName), errorCode)};
+            if(errorCode)
+            {
+                return nullptr;
+            }
+            const auto stamp{Detail::stampFile(path)};
+            if(!stamp.has_value())
+            {
+                return nullptr;
+            }
+
+            const auto key{Detail::fileKeyPrefix(path) + std::string(topNodeName)};
+            auto document{documents_.find(
+              key, [&](const Document & cached) { return cached.stamp == stamp.value(); })};
+
+            if(!document)
+            {
+                auto node{Common::getTopNodeFromFile(path.string(), topNodeName)};
+                if(!node.has_value())
+                {
+                    return nullptr;
+                }
+                document = std::make_shared<const Document>(
+                  Document{stamp.value(), std::move(node.value())});
+                documents_.insert(key, document, static_cast<size_t>(stamp->size));
+            }
+
+            return {document, &document->node};
+        }
+
+        /// Removes all cached documents of a file.
+        /// @param fileName The name of the file.
+        /// @return The number of removed documents.
+        size_t invalidate(std::string_view fileName)
+        {
+            const auto prefix{Detail::fileKeyPrefix(std::filesystem::path(fileName))};
+
+            return documents_.eraseIf(
+              [&prefix](const std::string & key) { return key.starts_with(prefix); });
+        }
+
+        /// Removes all cached documents.
+        void clear()
+        {
+            documents_.clear();
+        }
+
+        /// @return The hit, miss and eviction counters and the current size of the cache.
+        [[nodiscard]] FileParse::CacheStats stats() const
+        {
+            return documents_.stats();
+        }
+
+    private:
+        struct Document
+        {
+            Detail::FileStamp stamp;
+            NodeAdapter node;
+        };
+
+        FileParse::LruCache<std::string, Document> documents_;
+    };
+
+    /// Options of an ObjectCache.
+    struct ObjectCacheOptions
+    {
+        /// Maximum summed size of the files whose objects are cached.
+        size_t maxBytes{size_t{256u} * 1024u * 1024u};
+        /// Also compares a hash of the file content before reusing an object. This catches
+        /// changes that keep size and modification time, at the cost of reading the file on
+        /// every lookup.
+        bool verifyContentHash{false};
+    };
+
+    /// Keeps decoded objects in memory, so files that are loaded over and over are parsed and
+    /// decoded once. Objects are looked up by type, canonical path and node name and are only
+    /// reused while the size and modification time (and optionally the content hash) of the file
+    /// are unchanged. The size of a file is accounted as the size of its object.
+    class ObjectCache
+    {
+    public:
+        explicit ObjectCache(const ObjectCacheOptions & options = {}) :
+            verifyContentHash_(options.verifyContentHash), objects_(options.maxBytes)
+        {}
+
+        /// Deserializes an object from a file, unless an object decoded from the same file
+        /// content is cached. The format is detected like in loadFromFile, but a missing file
+        /// is not created.
+        /// @tparam T The type of object to deserialize (must have operator>> defined).
+        /// @param fileName The path to the file.
+        /// @param nodeTypeName The name of the root element/property.
+        /// @return Shared read-only object, or nullptr if the file cannot be loaded.
+        template<typename T>
+        [[nodiscard]] std::shared_ptr<const T> load(std::string_view fileName,
+                                                    const std::string & nodeTypeName)
+        {
+            std::error_code errorCode;
+            const auto path{std::filesystem::canonical(std::filesystem::path(fileName), errorCode)};
+            if(errorCode)
+            {
+                return nullptr;
+            }
+            const auto stamp{Detail::stampFile(path)};
+            if(!stamp.has_value())
+            {
+                return nullptr;
+            }
+            Signature signature{stamp.value(), 0u};
+
+            std::optional<std::string> content;
+            if(verifyContentHash_)
+            {
+                content = readFileToString(path.string());
+                if(!content.has_value())
+                {
+                    return nullptr;
+                }
+                signature.contentHash = FileParse::hashBytes(content.value());
+            }
+
+            // Type names are not unique, so the type is checked again before the object is cast
+            const std::type_index type{typeid(T)};
+            const auto key{Detail::fileKeyPrefix(path) + nodeTypeName + '\0' + type.name()};
+            if(const auto cached{objects_.find(key, [&](const Entry & entry) {
+                   return entry.type == type && entry.signature == signature;
+               })})
+            {
+                return std::static_pointer_cast<const T>(cached->object);
+            }
+
+            // The file may have been removed since it was stamped; it is never created
+            if(!content.has_value())
+            {
+                content = readFileToString(path.string());
+                if(!content.has_value())
+                {
+                    return nullptr;
+                }
+            }
+            Detail::stripByteOrderMark(content.value());
+            auto model{loadFromString<T>(
+              content.value(), nodeTypeName, Detail::detectFormat(path.string(), content.value()))};
+            if(!model.has_value())
+            {
+                return nullptr;
+            }
+
+            auto object{std::make_shared<const T>(std::move(model.value()))};
+            objects_.insert(key,
+                            std::make_shared<const Entry>(Entry{type, signature, object}),
+                            static_cast<size_t>(stamp->size));
+            return object;
+        }
+
+        /// Removes all cached objects decoded from a file.
+        /// @param fileName The name of the file.
+        /// @return The number of removed objects.
+        size_t invalidate(std::string_view fileName)
+        {
+            const auto prefix{Detail::fileKeyPrefix(std::filesystem::path(fileName))};
+
+            return objects_.eraseIf(
+              [&prefix](const std::string & key) { return key.starts_with(prefix); });
+        }
+
+        /// Removes all cached objects.
+        void clear()
+        {
+            objects_.clear();
+        }
+
+        /// @return The hit, miss and eviction counters and the current size of the cache.
+        [[nodiscard]] FileParse::CacheStats stats() const
+        {
+            return objects_.stats();
+        }
+
+    private:
+        struct Signature
+        {
+            Detail::FileStamp stamp;
+            std::uint64_t contentHash;
+
+            bool operator==(const Signature &) const = default;
+        };
+
+        struct Entry
+        {
+            std::type_index type;
+            Signature signature;
+            std::shared_ptr<const void> object;
+        };
+
+        bool verifyContentHash_;
+        FileParse::LruCache<std::string, Entry> objects_;
+    };
+
+    /// @return The cache used by loadFromFileCached when no cache is given.
+    [[nodiscard]] inline ObjectCache & defaultObjectCache()
+    {
+        static ObjectCache cache;
+        return cache;
+    }
+
+    /// Deserializes an object from a file through a cache of decoded objects, see ObjectCache.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param fileName The path to the file.
+    /// @param nodeTypeName The name of the root element/property.
+    /// @param cache The cache to use.
+    /// @return Shared read-only object, or nullptr if the file cannot be loaded.
+    template<typename T>
+    [[nodiscard]] std::shared_ptr<const T> loadFromFileCached(std::string_view fileName,
+                                                              const std::string & nodeTypeName,
+                                                              ObjectCache & cache
+                                                              = defaultObjectCache())
+    {
+        return cache.template load<T>(fileName, nodeTypeName);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Pipelined Functions
+    //////////////////////////////////////////////////////////////////////////
+
+    /// Retrieves the top-level node from a file that is read in chunks on a separate thread.
+    /// JSON is tokenized while the rest of the file is still being read. XML is not pipelined:
+    /// the XML parser needs the complete document, so XML files are read into one buffer and
+    /// parsed like in loadFromFile. The format is detected from the extension, then from the
+    /// first chunk. A UTF-8 byte order mark is skipped and a read error fails the load.
+    /// @param fileName The name of the file containing the data.
+    /// @param topNodeName The name of the top node to retrieve.
+    /// @param options The chunk size and the number of buffered chunks.
+    /// @return An optional containing the NodeAdapter if successful, std::nullopt otherwise.
+    [[nodiscard]] inline std::optional<NodeAdapter>
+      getTopNodeFromFilePipelined(std::string_view fileName,
+                                  std::string_view topNodeName,
+                                  const FileParse::PipelineOptions & options = {})
+    {
+        using namespace FileParse;
+
+        if(detectFileFormatFromExtension(fileName) == FileFormat::XML)
+        {
+            const auto content{Detail::readFileContent(fileName)};
+            return content.has_value() ? Detail::parseTopNode(content.value(), topNodeName)
+                                       : std::nullopt;
+        }
+
+        PipelinedFileReader reader{fileName, options};
+        if(!reader.isOpen())
+        {
+            return std::nullopt;
+        }
+
+        // The first chunk must be long enough to hold a byte order mark
+        auto firstChunk{reader.nextChunk().value_or(std::string{})};
+        while(firstChunk.size() < 3u)
+        {
+            const auto chunk{reader.nextChunk()};
+            if(!chunk.has_value())
+            {
+                break;
+            }
+            firstChunk += chunk.value();
+        }
+        Detail::stripByteOrderMark(firstChunk);
+
+        switch(Detail::detectFormat(fileName, firstChunk))
+        {
+            case FileFormat::XML: {
+                // Only files without a known extension get here
+                std::error_code errorCode;
+                const auto fileSize{std::filesystem::file_size(fileName, errorCode)};
+                firstChunk.reserve(errorCode ? 0u : static_cast<size_t>(fileSize));
+                reader.readRemaining(firstChunk);
+                if(reader.failed())
+                {
+                    break;
+                }
+                if(auto node = getXMLTopNodeFromString(firstChunk, topNodeName))
+                {
+                    return NodeAdapter{*node};
+                }
+                break;
+            }
+            case FileFormat::JSON: {
+                ChunkStreamBuffer buffer{reader, std::move(firstChunk)};
+                std::istream input{&buffer};
+                auto node{getJSONTopNodeFromStream(input, topNodeName)};
+                if(node.has_value() && !reader.failed())
+                {
+                    return NodeAdapter{*node};
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        return std::nullopt;
+    }
+
+    /// Deserializes an object from a file whose reading overlaps with parsing, see
+    /// getTopNodeFromFilePipelined. Decoding starts once the document is parsed; use
+    /// FileParse::ParallelChild in the operator>> of large collections to spread it over threads.
+    /// Unlike loadFromFile, a missing file is not created.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param fileName The path to the file.
+    /// @param nodeTypeName The name of the root element/property.
+    /// @param options The chunk size and the number of buffered chunks.
+    /// @return An optional containing the deserialized object, or std::nullopt on failure.
+    template<typename T>
+    std::optional<T> loadFromFilePipelined(std::string_view fileName,
+                                           const std::string & nodeTypeName,
+                                           const FileParse::PipelineOptions & options = {})
+    {
+        const auto node{getTopNodeFromFilePipelined(fileName, nodeTypeName, options)};
+        if(!node.has_value())
+        {
+            return std::nullopt;
+        }
+        return Detail::decodeTopNode<T>(node.value());
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Batch Functions
+    //////////////////////////////////////////////////////////////////////////
+
+    /// Options controlling how loadManyFromFiles distributes the work.
+    struct LoadManyOptions
+    {
+        /// Number of threads parsing files. Zero uses all threads of the executor.
+        size_t threadCount{0u};
+        /// Upper bound for the summed size of the files being parsed at the same time. A file
+        /// larger than the bound is parsed while no other file is in flight.
+        size_t maxInFlightBytes{size_t{256u} * 1024u * 1024u};
+        /// Executor running the parsing tasks. Null selects FileParse::defaultExecutor().
+        std::shared_ptr<FileParse::Executor> executor;
+    };
+
+    /// Result of loading a single file with loadManyFromFiles.
+    /// @tparam T The type of the deserialized object.
+    template<typename T>
+    struct LoadResult
+    {
+        /// The deserialized object, or std::nullopt if loading failed.
+        std::optional<T> value;
+        /// Description of the failure, empty on success.
+        std::string error;
+    };
+
+    /// Deserializes objects from many files concurrently. The format of every file is detected
+    /// like in loadFromFile. Unlike loadFromFile, missing files are reported as errors instead of
+    /// being created.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param fileNames The paths to the files.
+    /// @param nodeTypeName The name of the root element/property.
+    /// @param options The number of threads and the in-flight memory bound.
+    /// @return One result per file, in the order of fileNames.
+    template<typename T>
+    std::vector<LoadResult<T>> loadManyFromFiles(std::span<const std::filesystem::path> fileNames,
+                                                 const std::string & nodeTypeName,
+                                                 const LoadManyOptions & options = {})
+    {
+        std::vector<LoadResult<T>> results(fileNames.size());
+        FileParse::ByteBudget budget{options.maxInFlightBytes};
+
+        const auto executor{options.executor ? options.executor : FileParse::defaultExecutor()};
+
+        FileParse::parallelFor(*executor, fileNames.size(), options.threadCount, [&](size_t index) {
+            const auto fileName{fileNames[index].string()};
+            auto & result{results[index]};
+
+            std::error_code errorCode;
+            const auto fileSize{std::filesystem::file_size(fileNames[index], errorCode)};
+            if(errorCode)
+            {
+                result.error = fileName + ": " + errorCode.message();
+                return;
+            }
+
+            const auto bytes{budget.acquire(static_cast<size_t>(fileSize))};
+            try
+            {
+                // A file removed since its size was read is reported, never created
+                result.value = loadFromFile<T>(fileName, nodeTypeName, LoadOptions{false});
+                if(!result.value.has_value())
+                {
+                    result.error = std::filesystem::exists(fileNames[index], errorCode)
+                                     ? fileName + ": unable to load " + nodeTypeName
+                                     : fileName + ": cannot open file";
+                }
+            }
+            catch(const std::exception & exception)
+            {
+                result.error = fileName + ": " + exception.what();
+            }
+            catch(...)
+            {
+                result.error = fileName + ": unknown error";
+            }
+            budget.release(bytes);
+        });
+
+        return results;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Async Functions
+    //////////////////////////////////////////////////////////////////////////
+
+    namespace Detail
+    {
+        /// Reads, parses and decodes an object from a file, checking the token before every
+        /// stage. A missing file is not created.
+        template<typename T>
+        std::optional<T> loadFromFileInStages(const std::string & fileName,
+                                              const std::string & nodeTypeName,
+                                              const FileParse::CancellationToken & token)
+        {
+            token.throwIfCancelled();
+            const auto content{readFileContent(fileName)};
+            if(!content.has_value())
+            {
+                return std::nullopt;
+            }
+
+            token.throwIfCancelled();
+            const auto node{parseTopNode(content.value(), nodeTypeName)};
+            if(!node.has_value())
+            {
+                return std::nullopt;
+            }
+
+            token.throwIfCancelled();
+            return decodeTopNode<T>(node.value());
+        }
+
+        /// Serializes an object and writes it to a file, checking the token before every stage.
+        template<typename T>
+        int saveToFileInStages(const T & object,
+                               const std::string & fileName,
+                               const std::string & nodeName,
+                               const FileParse::CancellationToken & token)
+        {
+            token.throwIfCancelled();
+            const auto format{FileParse::detectFileFormatFromExtension(fileName)};
+            if(format == FileParse::FileFormat::Unknown)
+            {
+                return -1;
+            }
+            const auto content{saveToString(object, nodeName, format)};
+
+            token.throwIfCancelled();
+            return createFileFromString(fileName, content) ? 0 : 1;
+        }
+
+        /// @return The given executor, or the default executor if none is given.
+        inline std::shared_ptr<FileParse::Executor>
+          executorOrDefault(std::shared_ptr<FileParse::Executor> executor)
+        {
+            return executor ? std::move(executor) : FileParse::defaultExecutor();
+        }
+    }   // namespace Detail
+
+    /// Deserializes an object from a file on an executor. The file is read, parsed and decoded
+    /// in stages and the token is checked before every stage. Several calls in flight overlap
+    /// the disk reads of one file with the parsing of others. A missing file is not created.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param fileName The path to the file (format detected like in loadFromFile).
+    /// @param nodeTypeName The name of the root element/property.
+    /// @param token Token to cancel the operation.
+    /// @param executor The executor running the operation. Null selects the default executor.
+    /// @return A future holding the deserialized object, or std::nullopt on failure. The future
+    /// throws FileParse::OperationCancelled if the operation was cancelled.
+    template<typename T>
+    std::future<std::optional<T>>
+      loadFromFileAsync(std::string fileName,
+                        std::string nodeTypeName,
+                        FileParse::CancellationToken token = {},
+                        std::shared_ptr<FileParse::Executor> executor = nullptr)
+    {
+        return FileParse::submit(*Detail::executorOrDefault(std::move(executor)),
+                                 [fileName = std::move(fileName),
+                                  nodeTypeName = std::move(nodeTypeName),
+                                  token = std::move(token)]() {
+                                     return Detail::loadFromFileInStages<T>(
+                                       fileName, nodeTypeName, token);
+                                 });
+    }
+
+    /// Serializes an object to a file on an executor. The object is copied, so the caller may
+    /// modify the original while the operation runs. The token is checked before the object is
+    /// serialized and before the file is written, so a cancelled save never touches the file.
+    /// @tparam T The type of object to serialize (must have operator<< defined).
+    /// @param object The object to serialize.
+    /// @param fileName The path to the output file (format detected from extension).
+    /// @param nodeName The name of the root element/property.
+    /// @param token Token to cancel the operation.
+    /// @param executor The executor running the operation. Null selects the default executor.
+    /// @return A future holding 0 on success, -1 if format cannot be determined, or other
+    /// non-zero on write failure. The future throws FileParse::OperationCancelled if the
+    /// operation was cancelled.
+    template<typename T>
+    std::future<int> saveToFileAsync(T object,
+                                     std::string fileName,
+                                     std::string nodeName,
+                                     FileParse::CancellationToken token = {},
+                                     std::shared_ptr<FileParse::Executor> executor = nullptr)
+    {
+        return FileParse::submit(*Detail::executorOrDefault(std::move(executor)),
+                                 [object = std::move(object),
+                                  fileName = std::move(fileName),
+                                  nodeName = std::move(nodeName),
+                                  token = std::move(token)]() {
+                                     return Detail::saveToFileInStages(
+                                       object, fileName, nodeName, token);
+                                 });
+    }
+
+    /// Awaitable version of loadFromFileAsync for C++20 coroutines. The coroutine is resumed by
+    /// the task that loaded the object, on the given or the default executor.
+    /// @tparam T The type of object to deserialize (must have operator>> defined).
+    /// @param fileName The path to the file (format detected like in loadFromFile).
+    /// @param nodeTypeName The name of the root element/property.
+    /// @param token Token to cancel the operation.
+    /// @param executor The executor running the operation. Null selects the default executor.
+    /// @return Awaiter yielding the deserialized object, or std::nullopt on failure. Awaiting
+    /// throws FileParse::OperationCancelled if the operation was cancelled.
+    template<typename T>
+    [[nodiscard]] FileParse::OperationAwaiter<std::optional<T>>
+      loadFromFileAwaitable(std::string fileName,
+                            std::string nodeTypeName,
+                            FileParse::CancellationToken token = {},
+                            std::shared_ptr<FileParse::Executor> executor = nullptr)
+    {
+        return FileParse::schedule(
+          [fileName = std::move(fileName),
+           nodeTypeName = std::move(nodeTypeName),
+           token = std::move(token)]() {
+              return Detail::loadFromFileInStages<T>(fileName, nodeTypeName, token);
+          },
+          std::move(executor));
+    }
+
+    /// Awaitable version of saveToFileAsync for C++20 coroutines. The coroutine is resumed by
+    /// the task that saved the object, on the given or the default executor.
+    /// @tparam T The type of object to serialize (must have operator<< defined).
+    /// @param object The object to serialize.
+    /// @param fileName The path to the output file (format detected from extension).
+    /// @param nodeName The name of the root element/property.
+    /// @param token Token to cancel the operation.
+    /// @param executor The executor running the operation. Null selects the default executor.
+    /// @return Awaiter yielding the status of saveToFileAsync.
+    template<typename T>
+    [[nodiscard]] FileParse::OperationAwaiter<int>
+      saveToFileAwaitable(T object,
+                          std::string fileName,
+                          std::string nodeName,
+                          FileParse::CancellationToken token = {},
+                          std::shared_ptr<FileParse::Executor> executor = nullptr)
+    {
+        return FileParse::schedule(
+          [object = std::move(object),
+           fileName = std::move(fileName),
+           nodeName = std::move(nodeName),
+           token = std::move(token)]() {
+              return Detail::saveToFileInStages(object, fileName, nodeName, token);
+          },
+          std::move(executor));
+    }
+
+}   // namespace Common
@@ -0,0 +1,137 @@
+#include <atomic>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#if defined(_WIN32)
+#    include <fcntl.h>
+#    include <io.h>
+#else
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+#include "FileWriter.hxx"
+
+namespace FileParse
+{
+    namespace
+    {
+        // Unique within the process and distinct between threads, so concurrent writers of the
+        // same target never share a temporary file
+        std::filesystem::path temporaryPath(const std::filesystem::path & target)
+        {
+            static std::atomic<size_t> counter{0u};
+
+            const auto thread{std::hash<std::thread::id>{}(std::this_thread::get_id())};
+
+            auto name{target.filename().string()};
+            name += ".tmp." + std::to_string(thread) + "." + std::to_string(counter++);
+
+            return target.parent_path() / name;
+        }
+
+        bool syncPath(const std::filesystem::path & path, bool isDirectory)
+        {
+#if defined(_WIN32)
+            if(isDirectory)
+            {
+                // Directory entries cannot be flushed through the C runtime
+                return true;
+            }
+            const int fd{_wopen(path.c_str(), _O_RDWR | _O_BINARY)};
+            if(fd < 0)
+            {
+                return false;
+            }
+            const bool synced{_commit(fd) == 0};
+            _close(fd);
+            return synced;
+#else
+            const int fd{::open(path.c_str(), isDirectory ? O_RDONLY : O_WRONLY)};
+            if(fd < 0)
+            {
+                return false;
+            }
+            const bool synced{::fsync(fd) == 0};
+            ::close(fd);
+            return synced;
+#endif
+        }
+    }   // namespace
+
+    AtomicFileWriter::AtomicFileWriter(std::string_view fileName) :
+        target_(fileName),
+        temporary_(temporaryPath(target_)),
+        buffer_(std::make_unique<char[]>(bufferSize))
+    {
+        // The buffer has to be installed before the file is opened to take effect
+        stream_.rdbuf()->pubsetbuf(buffer_.get(), static_cast<std::streamsize>(bufferSize));
+        stream_.open(temporary_, std::ios::binary | std::ios::trunc);
+    }
+
+    AtomicFileWriter::~AtomicFileWriter()
+    {
+        if(!committed_)
+        {
+            stream_.close();
+            std::error_code errorCode;
+            std::filesystem::remove(temporary_, errorCode);
+        }
+    }
+
+    bool AtomicFileWriter::good() const
+    {
+        return stream_.is_open() && stream_.good();
+    }
+
+    std::ostream & AtomicFileWriter::stream()
+    {
+        return stream_;
+    }
+
+    bool AtomicFileWriter::commit(bool sync)
+    {
+        if(!stream_.is_open())
+        {
+            return false;
+        }
+
+        stream_.close();
+        if(stream_.fail() || (sync && !syncPath(temporary_, false)))
+        {
+            return false;
+        }
+
+        // Keep the permissions of the file being replaced
+        std::error_code errorCode;
+        if(const auto status{std::filesystem::status(target_, errorCode)};
+           !errorCode && std::filesystem::exists(status))
+        {
+            std::filesystem::permissions(temporary_, status.permissions(), errorCode);
+        }
+
+        std::filesystem::rename(temporary_, target_, errorCode);
+        if(errorCode)
+        {
+            return false;
+        }
+        committed_ = true;
+
+        if(sync)
+        {
+            const auto directory{target_.parent_path().empty() ? std::filesystem::path(".")
+                                                               : target_.parent_path()};
+            return syncPath(directory, true);
+        }
+        return true;
+    }
+
+    bool writeFileAtomically(std::string_view fileName, std::string_view content, bool sync)
+    {
+        AtomicFileWriter writer{fileName};
+        writer.stream().write(content.data(), static_cast<std::streamsize>(content.size()));
+        return writer.good() && writer.commit(sync);
+    }
+}   // namespace FileParse
@@ -0,0 +1,63 @@
+/// File: FileWriter.hxx
+/// @brief Provides atomic file replacement: content is written to a temporary file next to
+///        the target, which is renamed over the target once complete.
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string_view>
+
+namespace FileParse
+{
+    /// Writes a file so that readers see either the old or the complete new content, even if
+    /// the process dies while writing. The content is streamed through a large buffer into a
+    /// temporary file in the directory of the target. commit renames the temporary file over
+    /// the target; without a commit, the temporary file is removed and the target is untouched.
+    class AtomicFileWriter
+    {
+    public:
+        /// Size of the user-space buffer of the stream.
+        static constexpr size_t bufferSize{size_t{1u} * 1024u * 1024u};
+
+        /// Creates the temporary file.
+        /// @param fileName The name of the file to be replaced.
+        explicit AtomicFileWriter(std::string_view fileName);
+
+        /// Removes the temporary file unless it was committed.
+        ~AtomicFileWriter();
+
+        AtomicFileWriter(const AtomicFileWriter &) = delete;
+        AtomicFileWriter & operator=(const AtomicFileWriter &) = delete;
+
+        /// @return True if the temporary file was created and all writes succeeded so far.
+        [[nodiscard]] bool good() const;
+
+        /// @return The stream writing into the temporary file.
+        [[nodiscard]] std::ostream & stream();
+
+        /// Flushes the content, optionally forces it to the storage device and renames the
+        /// temporary file over the target.
+        /// @param sync Calls fsync on the file (and on POSIX on its directory) so the new
+        /// content survives a power loss.
+        /// @return True if the target now holds the new content.
+        [[nodiscard]] bool commit(bool sync = false);
+
+    private:
+        std::filesystem::path target_;
+        std::filesystem::path temporary_;
+        std::unique_ptr<char[]> buffer_;
+        std::ofstream stream_;
+        bool committed_{false};
+    };
+
+    /// Atomically replaces the content of a file, see AtomicFileWriter.
+    /// @param fileName The name of the file.
+    /// @param content The new content.
+    /// @param sync Forces the content to the storage device before the rename.
+    /// @return True if the file now holds the content.
+    [[nodiscard]] bool writeFileAtomically(std::string_view fileName,
+                                           std::string_view content,
+                                           bool sync = false);
+}   // namespace FileParse
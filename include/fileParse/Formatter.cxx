@@ -1,64 +1,143 @@
-#include <sstream>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
 
 #include "Formatter.hxx"
 
 namespace FileParse
 {
-
-    void trimTrailingZeros(std::string & str, bool useScientific)
+    namespace
     {
-        if(useScientific)
+        // Longest fixed notation output of a double is the 309 integer digits of DBL_MAX plus
+        // sign, decimal point and the requested number of decimals.
+        constexpr size_t maxFixedDigits{312};
+
+        bool isExponent(char c)
         {
-            // Find the exponent and trim zeros before it
-            auto ePos = str.find_first_of("eE");
-            auto lastNonZero = str.find_last_not_of('0', ePos - 1);
-            if(lastNonZero != std::string::npos && lastNonZero + 1 < ePos)
+            return c == 'e' || c == 'E';
+        }
+
+        /// Removes trailing zeros of the mantissa (and a dangling decimal point) in place.
+        /// @return The new end of the formatted number.
+        char * trimTrailingZeros(char * first, char * last, bool useScientific)
+        {
+            const char * dot{std::find(first, last, '.')};
+            if(dot == last)
             {
-                str.erase(lastNonZero + 1, ePos - lastNonZero - 1);
+                return last;
             }
-            // Remove the decimal point if it's directly before 'e' or 'E'
-            auto dotEPos = str.find_first_of(".eE", lastNonZero);
-            if (dotEPos != std::string::npos &&
-               (dotEPos + 1 < str.size()) &&
-               (str[dotEPos + 1] == 'e' || str[dotEPos + 1] == 'E'))
+
+            char * mantissaEnd{useScientific ? std::find_if(first, last, isExponent) : last};
+            char * trimmed{mantissaEnd};
+            while(*(trimmed - 1) == '0')
             {
-                str.erase(dotEPos, 1);
+                --trimmed;
+            }
+            if(*(trimmed - 1) == '.')
+            {
+                --trimmed;
             }
 
+            // Moves the exponent (if any) next to the trimmed mantissa
+            return std::copy(mantissaEnd, last, trimmed);
         }
-        else
+
+        /// Formats the value into [first, last).
+        /// @return The end of the formatted number or nullptr if the range is too small.
+        char * formatInto(char * first,
+                          char * last,
+                          double value,
+                          int precision,
+                          double scientificLowerBound,
+                          double scientificUpperBound)
         {
-            // Remove trailing zeros for non-scientific notation
-            str.erase(str.find_last_not_of('0') + 1, std::string::npos);
-            // Remove decimal point if no decimal part remains
-            if(str.back() == '.')
+            const bool useScientific{(std::abs(value) < scientificLowerBound
+                                      || std::abs(value) > scientificUpperBound)
+                                     && value != 0.0};
+
+            const auto [end, error]{std::to_chars(first,
+                                                  last,
+                                                  value,
+                                                  useScientific ? std::chars_format::scientific
+                                                                : std::chars_format::fixed,
+                                                  precision)};
+            if(error != std::errc())
             {
-                str.erase(str.length() - 1);
+                return nullptr;
             }
+
+            return trimTrailingZeros(first, end, useScientific);
         }
-    }
+    }   // namespace
 
-    std::string formatDouble(double value,
-                      int precision,
-                      double scientificLowerBound,
-                      double scientificUpperBound)
+    void appendFormattedDouble(std::string & output,
+                               double value,
+                               int precision,
+                               double scientificLowerBound,
+                               double scientificUpperBound)
     {
-        bool useScientific = (std::abs(value) < scientificLowerBound || std::abs(value) > scientificUpperBound)
-                             && value != 0.0;
+        // Streams treat a negative precision as the default one
+        if(precision < 0)
+        {
+            precision = 6;
+        }
+
+        std::array<char, 64> scratch{};
+        if(const char * end{formatInto(scratch.data(),
+                                       scratch.data() + scratch.size(),
+                                       value,
+                                       precision,
+                                       scientificLowerBound,
+                                       scientificUpperBound)})
+        {
+            output.append(scratch.data(), static_cast<size_t>(end - scratch.data()));
+            return;
+        }
 
-        std::ostringstream tempStream;
-        tempStream.setf(useScientific ? std::ios::scientific : std::ios::fixed, std::ios::floatfield);
-        tempStream.precision(precision);
-        tempStream << value;
+        // Large fixed notation values or a high precision do not fit into the scratch buffer
+        const auto offset{output.size()};
+        output.resize(offset + maxFixedDigits + static_cast<size_t>(precision));
+        const auto * end{formatInto(output.data() + offset,
+                                    output.data() + output.size(),
+                                    value,
+                                    precision,
+                                    scientificLowerBound,
+                                    scientificUpperBound)};
+        output.resize(static_cast<size_t>(end - output.data()));
+    }
 
-        std::string str = tempStream.str();  // Get the formatted string
+    void formatDoubles(std::span<const double> values,
+                       std::string & output,
+                       int precision,
+                       double scientificLowerBound,
+                       double scientificUpperBound,
+                       char separator)
+    {
+        // Typical values need a few characters beyond the requested precision
+        output.reserve(output.size()
+                       + values.size() * static_cast<size_t>(std::max(precision, 0) + 8));
 
-        // Trim trailing zeros if there is a decimal point in the string
-        if (str.find('.') != std::string::npos)
+        bool first{true};
+        for(const auto value : values)
         {
-            trimTrailingZeros(str, useScientific);
+            if(!first)
+            {
+                output += separator;
+            }
+            first = false;
+            appendFormattedDouble(
+              output, value, precision, scientificLowerBound, scientificUpperBound);
         }
+    }
 
-        return str;  // Return the final formatted string
+    std::string formatDouble(double value,
+                             int precision,
+                             double scientificLowerBound,
+                             double scientificUpperBound)
+    {
+        std::string result;
+        appendFormattedDouble(result, value, precision, scientificLowerBound, scientificUpperBound);
+        return result;
     }
-}   // namespace FileParse
\ No newline at end of file
+}   // namespace FileParse
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <span>
 #include <string>
 
 namespace FileParse
@@ -18,4 +19,31 @@ namespace FileParse
                                     int precision,
                                     double scientificLowerBound = 0.001,
                                     double scientificUpperBound = 100000);
-}
\ No newline at end of file
+
+    /// Formats a double value exactly like formatDouble and appends it to the output. No
+    /// temporary stream or string is created, so a reused output buffer does not allocate.
+    /// @param output The string the formatted value is appended to.
+    /// @param value The double value to format.
+    /// @param precision The number of significant digits to use.
+    /// @param scientificLowerBound Values below this threshold use scientific notation.
+    /// @param scientificUpperBound Values above this threshold use scientific notation.
+    extern void appendFormattedDouble(std::string & output,
+                                      double value,
+                                      int precision,
+                                      double scientificLowerBound = 0.001,
+                                      double scientificUpperBound = 100000);
+
+    /// Formats all values into one contiguous output buffer, separated by the separator.
+    /// @param values The double values to format.
+    /// @param output The string the formatted values are appended to.
+    /// @param precision The number of significant digits to use.
+    /// @param scientificLowerBound Values below this threshold use scientific notation.
+    /// @param scientificUpperBound Values above this threshold use scientific notation.
+    /// @param separator The character written between two values.
+    extern void formatDoubles(std::span<const double> values,
+                              std::string & output,
+                              int precision,
+                              double scientificLowerBound = 0.001,
+                              double scientificUpperBound = 100000,
+                              char separator = ' ');
+}
@@ -0,0 +1,49 @@
+/// File: Hash.hxx
+/// @brief Provides a fast non-cryptographic hash used to detect changed file content.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace FileParse
+{
+    /// Hashes bytes eight at a time. The result depends on the byte order of the machine, so it
+    /// is meant for comparisons within one process or machine, not for storage.
+    /// @param bytes The bytes to hash.
+    /// @return The 64 bit hash.
+    [[nodiscard]] inline std::uint64_t hashBytes(std::string_view bytes)
+    {
+        constexpr std::uint64_t prime1{0x9E3779B185EBCA87ull};
+        constexpr std::uint64_t prime2{0xC2B2AE3D27D4EB4Full};
+
+        auto mix = [](std::uint64_t hash, std::uint64_t word) {
+            hash ^= word * prime2;
+            hash = (hash << 31u) | (hash >> 33u);
+            return hash * prime1;
+        };
+
+        std::uint64_t hash{prime1 ^ bytes.size()};
+
+        size_t offset{0u};
+        for(; offset + sizeof(std::uint64_t) <= bytes.size(); offset += sizeof(std::uint64_t))
+        {
+            std::uint64_t word;
+            std::memcpy(&word, bytes.data() + offset, sizeof(word));
+            hash = mix(hash, word);
+        }
+        if(offset < bytes.size())
+        {
+            std::uint64_t word{0u};
+            std::memcpy(&word, bytes.data() + offset, bytes.size() - offset);
+            hash = mix(hash, word);
+        }
+
+        // Final avalanche so that every input bit affects every output bit
+        hash ^= hash >> 33u;
+        hash *= prime2;
+        hash ^= hash >> 29u;
+        return hash;
+    }
+}   // namespace FileParse
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <optional>
 
@@ -40,15 +42,66 @@ public:
     /// Counts the number of child nodes with the specified name.
     [[nodiscard]] virtual int nChildNode(std::string_view name) const = 0;
 
+    /// Counts the child nodes with the specified name without materializing them. Both adapters
+    /// keep this count at hand (XML child list, JSON array size), so it is the cheap way to pre-size
+    /// containers before decoding.
+    [[nodiscard]] size_t countChildren(std::string_view name) const
+    {
+        const auto count{nChildNode(name)};
+        return count > 0 ? static_cast<size_t>(count) : 0u;
+    }
+
     /// Checks if the current node has a child node with the specified name.
     [[nodiscard]] virtual bool hasChildNode(std::string_view name) const = 0;
 
     /// Adds a child node with the specified name to the current node.
     [[nodiscard]] virtual AdapterType addChild(std::string_view name) = 0;
 
+    /// Checks if the adapter implements createDetachedNode and appendChild. Adapters that do not
+    /// are serialized on the calling thread by ParallelChild.
+    [[nodiscard]] virtual bool supportsDetachedNodes() const
+    {
+        return false;
+    }
+
+    /// Creates a node with the specified name that does not belong to the current document. It
+    /// can be filled on another thread and attached later with appendChild.
+    /// @throws std::logic_error Unless the adapter supports detached nodes.
+    [[nodiscard]] virtual AdapterType createDetachedNode(std::string_view) const
+    {
+        throw std::logic_error("Detached nodes are not supported by this node adapter");
+    }
+
+    /// Moves a node created by createDetachedNode, together with its subtree, to the end of the
+    /// child nodes of the current node. The appended node must not be used afterwards.
+    /// @throws std::logic_error Unless the adapter supports detached nodes.
+    virtual void appendChild(AdapterType &)
+    {
+        throw std::logic_error("Detached nodes are not supported by this node adapter");
+    }
+
     /// Adds text content to the current node.
     virtual void addText(std::string_view text) = 0;
 
+    /// Adds a child node holding a packed sequence of numeric values given as whitespace separated
+    /// text. By default the text becomes the content of the child, as in XML; JSON overrides this
+    /// to store a native array of numbers.
+    virtual void addPackedValues(std::string_view name, std::string_view values)
+    {
+        addChild(name).addText(values);
+    }
+
+    /// Gets the packed numeric values of the child node with the specified name as whitespace
+    /// separated text.
+    [[nodiscard]] virtual std::optional<std::string> getPackedValues(std::string_view name) const
+    {
+        if(auto child{getFirstChildByName(name)}; child.has_value())
+        {
+            return child->getText();
+        }
+        return std::nullopt;
+    }
+
     // Adds content of the entire node structure with child into string (the same content
     // that will be in the file).
     [[nodiscard]] virtual std::string getContent() const = 0;
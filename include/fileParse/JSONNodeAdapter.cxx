@@ -1,32 +1,187 @@
 #include "JSONNodeAdapter.hxx"
+#include "FileWriter.hxx"
 
 #include <nlohmann/json.hpp>
 
+#include <atomic>
+#include <charconv>
+#include <cmath>
 #include <fstream>
+#include <iomanip>
+#include <memory_resource>
+#include <stdexcept>
+
+namespace
+{
+    // Owns the nodes of a document together with the arena they are allocated from
+    struct JSONDocument
+    {
+#ifdef FILEPARSE_JSON_ARENA
+        explicit JSONDocument(size_t arenaSize) :
+            arena(arenaSize > 0u ? std::make_unique<std::pmr::monotonic_buffer_resource>(arenaSize)
+                                 : nullptr)
+        {}
+
+        [[nodiscard]] bool ownsArena() const
+        {
+            return arena != nullptr;
+        }
+
+        std::unique_ptr<std::pmr::monotonic_buffer_resource> arena;
+#else
+        explicit JSONDocument(size_t)
+        {}
+
+        [[nodiscard]] bool ownsArena() const
+        {
+            return false;
+        }
+#endif
+        // Documents whose nodes were moved into this one by appendChild
+        std::vector<std::shared_ptr<JSONDocument>> retained;
+        // Declared last, so the nodes are destroyed before the arena they live in
+        FileParse::Json root;
+    };
+
+    // Allocates the nodes created while the scope is alive from the arena of a document, or from
+    // the heap for nullptr. nlohmann::basic_json creates its allocators on demand, so they cannot
+    // carry the arena; only the operations of the document make its arena current. Without
+    // FILEPARSE_JSON_ARENA, nodes always come from the heap and the scope does nothing.
+    class DocumentAllocation
+    {
+    public:
+#ifdef FILEPARSE_JSON_ARENA
+        explicit DocumentAllocation(const JSONDocument * document) :
+            arena_(document != nullptr ? document->arena.get() : nullptr)
+        {}
+
+    private:
+        FileParse::ScopedArena arena_;
+#else
+        explicit DocumentAllocation(const JSONDocument *)
+        {}
+#endif
+    };
+
+    std::atomic<size_t> jsonArenaSize{4096u};
+
+    std::shared_ptr<JSONDocument> makeDocument()
+    {
+        return std::make_shared<JSONDocument>(jsonArenaSize.load(std::memory_order_relaxed));
+    }
+
+    // Makes the root of the document an object holding an empty top node
+    FileParse::Json::iterator addTopNode(JSONDocument & document, std::string_view topNodeName)
+    {
+        const DocumentAllocation allocation{&document};
+        auto & root{document.root};
+        root = FileParse::Json::object();
+        root[FileParse::JsonString(topNodeName)] = FileParse::Json::object();
+        return root.begin();
+    }
+
+    // Strings of a document are allocated from its arena and handed out as std::string copies
+    std::string toString(const FileParse::Json & json)
+    {
+        return std::string(json.get_ref<const FileParse::JsonString &>());
+    }
+
+    // Integral tokens stay integers so that integer sequences round trip unchanged. Non-negative
+    // ones are read as unsigned, which covers the whole range of uint64_t. Other tokens must be
+    // finite doubles in full, as JSON has no representation for infinity and NaN.
+    FileParse::Json parsePackedToken(std::string_view token)
+    {
+        // std::from_chars does not take a leading '+'
+        const bool plus{token.front() == '+'};
+        const auto number{plus ? token.substr(1u) : token};
+        const auto * last{number.data() + number.size()};
+        if(plus && number.starts_with('-'))
+        {
+            throw std::invalid_argument("Invalid packed value: " + std::string(token));
+        }
+
+        if(!number.empty() && number.find_first_not_of("-0123456789") == std::string_view::npos)
+        {
+            if(number.front() == '-')
+            {
+                std::int64_t value{0};
+                if(const auto [end, error]{std::from_chars(number.data(), last, value)};
+                   error == std::errc{} && end == last)
+                {
+                    return value;
+                }
+            }
+            else
+            {
+                std::uint64_t value{0u};
+                if(const auto [end, error]{std::from_chars(number.data(), last, value)};
+                   error == std::errc{} && end == last)
+                {
+                    return value;
+                }
+            }
+        }
+
+        double value{0.0};
+        const auto [end, error]{std::from_chars(number.data(), last, value)};
+        if(error == std::errc::result_out_of_range)
+        {
+            throw std::out_of_range("Packed value out of range: " + std::string(token));
+        }
+        if(error != std::errc{} || end != last || !std::isfinite(value))
+        {
+            throw std::invalid_argument("Invalid packed value: " + std::string(token));
+        }
+        return value;
+    }
+}   // namespace
 
 struct JSONNodeAdapter::Impl
 {
-    explicit Impl(nlohmann::json * jsonPtr, std::string key)
-        : jsonPtr_(jsonPtr), key_(std::move(key))
+    explicit Impl(FileParse::Json * jsonPtr,
+                  std::string_view key,
+                  std::shared_ptr<JSONDocument> document = nullptr) :
+        document_(std::move(document)), jsonPtr_(jsonPtr), key_(key)
     {}
 
     // For root nodes that own the JSON data
-    explicit Impl(std::shared_ptr<nlohmann::json> ownedJson, std::string key)
-        : ownedJson_(std::move(ownedJson)), jsonPtr_(ownedJson_.get()), key_(std::move(key))
+    explicit Impl(std::shared_ptr<JSONDocument> document, std::string_view key) :
+        document_(document), ownedJson_(document, &document->root), jsonPtr_(ownedJson_.get()),
+        key_(key)
     {}
 
-    std::shared_ptr<nlohmann::json> ownedJson_;   // For root ownership
-    nlohmann::json * jsonPtr_;
-    std::string key_;
+    std::shared_ptr<JSONDocument> document_;
+    std::shared_ptr<FileParse::Json> ownedJson_;   // For root ownership
+    FileParse::Json * jsonPtr_;
+    // Views the key of the node in the document, which the adapter keeps alive. Only names given
+    // to the public constructor are interned, as nothing else would own them.
+    std::string_view key_;
 };
 
-JSONNodeAdapter::JSONNodeAdapter(nlohmann::json * jsonPtr, std::string key)
-    : pimpl_(std::make_shared<Impl>(jsonPtr, std::move(key)))
+void setJSONArenaSize(size_t initialBytes)
+{
+    jsonArenaSize.store(initialBytes, std::memory_order_relaxed);
+}
+
+size_t getJSONArenaSize()
+{
+    return jsonArenaSize.load(std::memory_order_relaxed);
+}
+
+JSONNodeAdapter::JSONNodeAdapter(FileParse::Json * jsonPtr, std::string key)
+    : pimpl_(std::make_shared<Impl>(jsonPtr, FileParse::Tag{key}.view()))
 {}
 
 JSONNodeAdapter::JSONNodeAdapter(std::shared_ptr<Impl> impl) : pimpl_(std::move(impl))
 {}
 
+JSONNodeAdapter JSONNodeAdapter::makeDocumentNode(const FileParse::Json & json,
+                                                  std::string_view key) const
+{
+    return JSONNodeAdapter(
+      std::make_shared<Impl>(const_cast<FileParse::Json *>(&json), key, pimpl_->document_));
+}
+
 bool JSONNodeAdapter::isEmpty() const
 {
     return pimpl_->jsonPtr_ == nullptr || pimpl_->jsonPtr_->is_null();
@@ -34,7 +189,7 @@ bool JSONNodeAdapter::isEmpty() const
 
 std::string JSONNodeAdapter::getCurrentTag() const
 {
-    return pimpl_->key_;
+    return std::string(pimpl_->key_);
 }
 
 std::string JSONNodeAdapter::getText() const
@@ -48,7 +203,7 @@ std::string JSONNodeAdapter::getText() const
 
     if(json.is_string())
     {
-        return json.get<std::string>();
+        return toString(json);
     }
     if(json.is_number_integer())
     {
@@ -79,34 +234,36 @@ std::vector<JSONNodeAdapter> JSONNodeAdapter::getChildNodes() const
         return children;
     }
 
+    // Read paths only use const access so that concurrent readers never modify the document
     const auto & json = *pimpl_->jsonPtr_;
 
     if(json.is_object())
     {
+        children.reserve(json.size());
         for(auto it = json.begin(); it != json.end(); ++it)
         {
+            const std::string_view key{it.key()};
+
             // For arrays, create a child for each element
             if(it.value().is_array())
             {
-                for(size_t i = 0; i < it.value().size(); ++i)
+                for(const auto & element : it.value())
                 {
-                    children.emplace_back(
-                      const_cast<nlohmann::json *>(&((*pimpl_->jsonPtr_)[it.key()][i])), it.key());
+                    children.push_back(makeDocumentNode(element, key));
                 }
             }
             else
             {
-                children.emplace_back(
-                  const_cast<nlohmann::json *>(&((*pimpl_->jsonPtr_)[it.key()])), it.key());
+                children.push_back(makeDocumentNode(it.value(), key));
             }
         }
     }
     else if(json.is_array())
     {
-        for(size_t i = 0; i < json.size(); ++i)
+        children.reserve(json.size());
+        for(const auto & element : json)
         {
-            children.emplace_back(const_cast<nlohmann::json *>(&((*pimpl_->jsonPtr_)[i])),
-                                  pimpl_->key_);
+            children.push_back(makeDocumentNode(element, pimpl_->key_));
         }
     }
 
@@ -120,18 +277,19 @@ std::optional<JSONNodeAdapter> JSONNodeAdapter::getFirstChildByName(std::string_
         return std::nullopt;
     }
 
-    const std::string nameStr(name);
-    if(pimpl_->jsonPtr_->contains(nameStr))
+    const auto & json = *pimpl_->jsonPtr_;
+    const auto it = json.find(name);
+    if(it == json.end())
     {
-        auto & child = (*pimpl_->jsonPtr_)[nameStr];
-        if(child.is_array() && !child.empty())
-        {
-            return JSONNodeAdapter(&child[0], nameStr);
-        }
-        return JSONNodeAdapter(&child, nameStr);
+        return std::nullopt;
     }
 
-    return std::nullopt;
+    const auto & child = *it;
+    if(child.is_array() && !child.empty())
+    {
+        return makeDocumentNode(child.front(), it.key());
+    }
+    return makeDocumentNode(child, it.key());
 }
 
 std::vector<JSONNodeAdapter> JSONNodeAdapter::getChildNodesByName(std::string_view name) const
@@ -143,22 +301,28 @@ std::vector<JSONNodeAdapter> JSONNodeAdapter::getChildNodesByName(std::string_vi
         return children;
     }
 
-    const std::string nameStr(name);
-    if(pimpl_->jsonPtr_->contains(nameStr))
+    const auto & json = *pimpl_->jsonPtr_;
+    const auto it = json.find(name);
+    if(it == json.end())
     {
-        auto & child = (*pimpl_->jsonPtr_)[nameStr];
-        if(child.is_array())
-        {
-            for(size_t i = 0; i < child.size(); ++i)
-            {
-                children.emplace_back(&child[i], nameStr);
-            }
-        }
-        else
+        return children;
+    }
+
+    // All children view the key in the document instead of holding a copy each
+    const std::string_view key{it.key()};
+    const auto & child = *it;
+    if(child.is_array())
+    {
+        children.reserve(child.size());
+        for(const auto & element : child)
         {
-            children.emplace_back(&child, nameStr);
+            children.push_back(makeDocumentNode(element, key));
         }
     }
+    else
+    {
+        children.push_back(makeDocumentNode(child, key));
+    }
 
     return children;
 }
@@ -170,18 +334,14 @@ int JSONNodeAdapter::nChildNode(std::string_view name) const
         return 0;
     }
 
-    const std::string nameStr(name);
-    if(pimpl_->jsonPtr_->contains(nameStr))
+    const auto & json = *pimpl_->jsonPtr_;
+    const auto it = json.find(name);
+    if(it == json.end())
     {
-        const auto & child = (*pimpl_->jsonPtr_)[nameStr];
-        if(child.is_array())
-        {
-            return static_cast<int>(child.size());
-        }
-        return 1;
+        return 0;
     }
 
-    return 0;
+    return it->is_array() ? static_cast<int>(it->size()) : 1;
 }
 
 bool JSONNodeAdapter::hasChildNode(std::string_view name) const
@@ -191,7 +351,7 @@ bool JSONNodeAdapter::hasChildNode(std::string_view name) const
         return false;
     }
 
-    return pimpl_->jsonPtr_->contains(std::string(name));
+    return pimpl_->jsonPtr_->contains(name);
 }
 
 JSONNodeAdapter JSONNodeAdapter::addChild(std::string_view name)
@@ -201,36 +361,88 @@ JSONNodeAdapter JSONNodeAdapter::addChild(std::string_view name)
         return JSONNodeAdapter(nullptr, std::string(name));
     }
 
+    const DocumentAllocation allocation{pimpl_->document_.get()};
+
     // Ensure the current node is an object
     if(!pimpl_->jsonPtr_->is_object())
     {
-        *pimpl_->jsonPtr_ = nlohmann::json::object();
+        *pimpl_->jsonPtr_ = FileParse::Json::object();
     }
 
-    const std::string nameStr(name);
+    // The key is only copied into the document when the child does not exist yet; the new node
+    // views the key stored in the document
+    auto & object{pimpl_->jsonPtr_->get_ref<FileParse::Json::object_t &>()};
+    auto slot{object.find(name)};
 
     // If child doesn't exist, create it as an object
-    if(!pimpl_->jsonPtr_->contains(nameStr))
+    if(slot == object.end())
     {
-        (*pimpl_->jsonPtr_)[nameStr] = nlohmann::json::object();
-        return JSONNodeAdapter(&(*pimpl_->jsonPtr_)[nameStr], nameStr);
+        slot = object.emplace(FileParse::JsonString(name), FileParse::Json::object()).first;
+        return makeDocumentNode(slot->second, slot->first);
     }
 
     // Child exists - convert to array or append to existing array
-    auto & existing = (*pimpl_->jsonPtr_)[nameStr];
+    auto & existing = slot->second;
     if(!existing.is_array())
     {
         // Convert existing value to array
-        nlohmann::json arr = nlohmann::json::array();
+        FileParse::Json arr = FileParse::Json::array();
         arr.push_back(std::move(existing));
-        arr.push_back(nlohmann::json::object());
-        (*pimpl_->jsonPtr_)[nameStr] = std::move(arr);
-        return JSONNodeAdapter(&(*pimpl_->jsonPtr_)[nameStr].back(), nameStr);
+        arr.push_back(FileParse::Json::object());
+        existing = std::move(arr);
+        return makeDocumentNode(existing.back(), slot->first);
     }
 
     // Already an array, append new object
-    existing.push_back(nlohmann::json::object());
-    return JSONNodeAdapter(&existing.back(), nameStr);
+    existing.push_back(FileParse::Json::object());
+    return makeDocumentNode(existing.back(), slot->first);
+}
+
+bool JSONNodeAdapter::supportsDetachedNodes() const
+{
+    return true;
+}
+
+JSONNodeAdapter JSONNodeAdapter::createDetachedNode(std::string_view name) const
+{
+    // Detached nodes are usually small and end up in another document, so they are allocated
+    // from the heap instead of each bringing an arena that the target would have to retain
+    auto document{std::make_shared<JSONDocument>(0u)};
+    const auto topNode{addTopNode(*document, name)};
+
+    auto impl = std::make_shared<Impl>(document, topNode.key());
+    impl->jsonPtr_ = &*topNode;
+
+    return JSONNodeAdapter(std::move(impl));
+}
+
+void JSONNodeAdapter::appendChild(JSONNodeAdapter & child)
+{
+    if(pimpl_->jsonPtr_ == nullptr || child.pimpl_->jsonPtr_ == nullptr)
+    {
+        return;
+    }
+
+    // The slot is created exactly like addChild would, so repeated names still become an array
+    auto slot{addChild(child.pimpl_->key_)};
+
+    const auto & document{pimpl_->document_};
+    const auto & childDocument{child.pimpl_->document_};
+    if(childDocument != nullptr && childDocument->ownsArena() && childDocument != document)
+    {
+        if(document == nullptr)
+        {
+            // Nothing would keep the arena of the moved nodes alive, so they are copied to the heap
+            const DocumentAllocation heap{nullptr};
+            *slot.pimpl_->jsonPtr_ = *child.pimpl_->jsonPtr_;
+            return;
+        }
+
+        // The moved nodes stay in the arena of the child document, which is kept alive with this
+        // one. Nodes of detached documents come from the heap and need nothing to be retained.
+        document->retained.push_back(childDocument);
+    }
+    *slot.pimpl_->jsonPtr_ = std::move(*child.pimpl_->jsonPtr_);
 }
 
 void JSONNodeAdapter::addText(std::string_view text)
@@ -240,7 +452,71 @@ void JSONNodeAdapter::addText(std::string_view text)
         return;
     }
 
-    *pimpl_->jsonPtr_ = std::string(text);
+    const DocumentAllocation allocation{pimpl_->document_.get()};
+
+    *pimpl_->jsonPtr_ = FileParse::JsonString(text);
+}
+
+void JSONNodeAdapter::addPackedValues(std::string_view name, std::string_view values)
+{
+    if(pimpl_->jsonPtr_ == nullptr)
+    {
+        return;
+    }
+
+    const DocumentAllocation allocation{pimpl_->document_.get()};
+
+    // Ensure the current node is an object
+    if(!pimpl_->jsonPtr_->is_object())
+    {
+        *pimpl_->jsonPtr_ = FileParse::Json::object();
+    }
+
+    auto array = FileParse::Json::array();
+
+    constexpr std::string_view delimiters{" \t\r\n,"};
+    auto start = values.find_first_not_of(delimiters);
+    while(start != std::string_view::npos)
+    {
+        auto end = values.find_first_of(delimiters, start);
+        array.push_back(parsePackedToken(values.substr(start, end - start)));
+
+        start = values.find_first_not_of(delimiters, end);
+    }
+
+    (*pimpl_->jsonPtr_)[FileParse::JsonString(name)] = std::move(array);
+}
+
+std::optional<std::string> JSONNodeAdapter::getPackedValues(std::string_view name) const
+{
+    if(pimpl_->jsonPtr_ == nullptr || !pimpl_->jsonPtr_->is_object())
+    {
+        return std::nullopt;
+    }
+
+    const auto & json = *pimpl_->jsonPtr_;
+    const auto it = json.find(name);
+    if(it == json.end())
+    {
+        return std::nullopt;
+    }
+
+    if(!it->is_array())
+    {
+        return makeDocumentNode(*it, it.key()).getText();
+    }
+
+    std::string result;
+    for(const auto & value : *it)
+    {
+        if(!result.empty())
+        {
+            result += ' ';
+        }
+        result += value.is_string() ? toString(value) : std::string(value.dump());
+    }
+
+    return result;
 }
 
 int JSONNodeAdapter::writeToFile(std::string_view fileName) const
@@ -250,31 +526,34 @@ int JSONNodeAdapter::writeToFile(std::string_view fileName) const
         return 1;
     }
 
-    const std::string fileNameStr{fileName};
-    std::ofstream file{fileNameStr};
-    if(!file.is_open())
+    FileParse::AtomicFileWriter writer{fileName};
+    if(!writer.good())
     {
         return 1;
     }
 
+    // The document is streamed into the file instead of being dumped into a string first.
     // If this is a root node with ownership, write the owned JSON
     // Otherwise, wrap in an object with the key if it has one
+    auto & file{writer.stream()};
+    file << std::setw(4);
     if(pimpl_->ownedJson_)
     {
-        file << pimpl_->ownedJson_->dump(4);
+        file << *pimpl_->ownedJson_;
     }
     else if(!pimpl_->key_.empty())
     {
-        nlohmann::json wrapper;
-        wrapper[pimpl_->key_] = *pimpl_->jsonPtr_;
-        file << wrapper.dump(4);
+        const DocumentAllocation heap{nullptr};
+        FileParse::Json wrapper;
+        wrapper[FileParse::JsonString(pimpl_->key_)] = *pimpl_->jsonPtr_;
+        file << wrapper;
     }
     else
     {
-        file << pimpl_->jsonPtr_->dump(4);
+        file << *pimpl_->jsonPtr_;
     }
 
-    return 0;
+    return writer.good() && writer.commit() ? 0 : 1;
 }
 
 std::string JSONNodeAdapter::getContent() const
@@ -287,18 +566,19 @@ std::string JSONNodeAdapter::getContent() const
     // If this is a root node with ownership, return the owned JSON
     if(pimpl_->ownedJson_)
     {
-        return pimpl_->ownedJson_->dump(4);
+        return std::string(pimpl_->ownedJson_->dump(4));
     }
 
     // Otherwise, wrap in an object with the key if it has one
     if(!pimpl_->key_.empty())
     {
-        nlohmann::json wrapper;
-        wrapper[pimpl_->key_] = *pimpl_->jsonPtr_;
-        return wrapper.dump(4);
+        const DocumentAllocation heap{nullptr};
+        FileParse::Json wrapper;
+        wrapper[FileParse::JsonString(pimpl_->key_)] = *pimpl_->jsonPtr_;
+        return std::string(wrapper.dump(4));
     }
 
-    return pimpl_->jsonPtr_->dump(4);
+    return std::string(pimpl_->jsonPtr_->dump(4));
 }
 
 void JSONNodeAdapter::addAttribute(std::string_view name, std::string_view value)
@@ -308,14 +588,16 @@ void JSONNodeAdapter::addAttribute(std::string_view name, std::string_view value
         return;
     }
 
+    const DocumentAllocation allocation{pimpl_->document_.get()};
+
     // Ensure the current node is an object
     if(!pimpl_->jsonPtr_->is_object())
     {
-        *pimpl_->jsonPtr_ = nlohmann::json::object();
+        *pimpl_->jsonPtr_ = FileParse::Json::object();
     }
 
     // Store attribute with @ prefix to distinguish from child nodes
-    (*pimpl_->jsonPtr_)["@" + std::string(name)] = std::string(value);
+    (*pimpl_->jsonPtr_)[FileParse::JsonString("@").append(name)] = FileParse::JsonString(value);
 }
 
 std::optional<std::string> JSONNodeAdapter::getAttribute(std::string_view name) const
@@ -326,13 +608,14 @@ std::optional<std::string> JSONNodeAdapter::getAttribute(std::string_view name)
     }
 
     // Look for attribute with @ prefix
-    const std::string nameStr = "@" + std::string(name);
-    if(pimpl_->jsonPtr_->contains(nameStr))
+    const auto & json = *pimpl_->jsonPtr_;
+    const auto attributeName{"@" + std::string(name)};
+    if(const auto it = json.find(std::string_view(attributeName)); it != json.end())
     {
-        const auto & val = (*pimpl_->jsonPtr_)[nameStr];
+        const auto & val = *it;
         if(val.is_string())
         {
-            return val.get<std::string>();
+            return toString(val);
         }
         if(val.is_number_integer())
         {
@@ -357,13 +640,12 @@ std::optional<std::string> JSONNodeAdapter::getAttribute(std::string_view name)
 
 JSONNodeAdapter createJSONTopNode(std::string_view topNodeName)
 {
-    auto root = std::make_shared<nlohmann::json>(nlohmann::json::object());
-    const std::string topNodeStr(topNodeName);
-    (*root)[topNodeStr] = nlohmann::json::object();
+    auto document{makeDocument()};
+    const auto topNode{addTopNode(*document, topNodeName)};
 
     // Create adapter for the inner node (the actual top node)
-    auto impl = std::make_shared<JSONNodeAdapter::Impl>(root, topNodeStr);
-    impl->jsonPtr_ = &(*root)[topNodeStr];
+    auto impl = std::make_shared<JSONNodeAdapter::Impl>(document, topNode.key());
+    impl->jsonPtr_ = &*topNode;
 
     return JSONNodeAdapter(std::move(impl));
 }
@@ -371,26 +653,34 @@ JSONNodeAdapter createJSONTopNode(std::string_view topNodeName)
 std::optional<JSONNodeAdapter> getJSONTopNodeFromFile(std::string_view fileName,
                                                        std::string_view topNodeName)
 {
-    try
+    const std::string fileNameStr{fileName};
+    std::ifstream file{fileNameStr};
+    if(!file.is_open())
     {
-        const std::string fileNameStr{fileName};
-        std::ifstream file{fileNameStr};
-        if(!file.is_open())
-        {
-            return std::nullopt;
-        }
+        return std::nullopt;
+    }
 
-        auto root = std::make_shared<nlohmann::json>();
-        file >> *root;
+    return getJSONTopNodeFromStream(file, topNodeName);
+}
 
-        const std::string topNodeStr(topNodeName);
-        if(!root->is_object() || !root->contains(topNodeStr))
+std::optional<JSONNodeAdapter> getJSONTopNodeFromStream(std::istream & input,
+                                                         std::string_view topNodeName)
+{
+    try
+    {
+        auto document{makeDocument()};
+        const DocumentAllocation allocation{document.get()};
+        auto & root{document->root};
+        input >> root;
+
+        const auto topNode{root.find(topNodeName)};
+        if(topNode == root.end())
         {
             return std::nullopt;
         }
 
-        auto impl = std::make_shared<JSONNodeAdapter::Impl>(root, topNodeStr);
-        impl->jsonPtr_ = &(*root)[topNodeStr];
+        auto impl = std::make_shared<JSONNodeAdapter::Impl>(document, topNode.key());
+        impl->jsonPtr_ = &*topNode;
 
         return JSONNodeAdapter(std::move(impl));
     }
@@ -405,16 +695,19 @@ std::optional<JSONNodeAdapter> getJSONTopNodeFromString(std::string_view json,
 {
     try
     {
-        auto root = std::make_shared<nlohmann::json>(nlohmann::json::parse(json));
+        auto document{makeDocument()};
+        const DocumentAllocation allocation{document.get()};
+        auto & root{document->root};
+        root = FileParse::Json::parse(json);
 
-        const std::string topNodeStr(topNodeName);
-        if(!root->is_object() || !root->contains(topNodeStr))
+        const auto topNode{root.find(topNodeName)};
+        if(topNode == root.end())
         {
             return std::nullopt;
         }
 
-        auto impl = std::make_shared<JSONNodeAdapter::Impl>(root, topNodeStr);
-        impl->jsonPtr_ = &(*root)[topNodeStr];
+        auto impl = std::make_shared<JSONNodeAdapter::Impl>(document, topNode.key());
+        impl->jsonPtr_ = &*topNode;
 
         return JSONNodeAdapter(std::move(impl));
     }
@@ -423,3 +716,90 @@ std::optional<JSONNodeAdapter> getJSONTopNodeFromString(std::string_view json,
         return std::nullopt;
     }
 }
+
+namespace
+{
+    // Parses a document that failed to parse once more to find the keys of the objects enclosing
+    // the syntax error. Documents without errors are parsed without the callback.
+    std::string errorNodePath(std::string_view json)
+    {
+        using Event = FileParse::Json::parse_event_t;
+
+        std::vector<std::string> keys;
+        const FileParse::Json::parser_callback_t trackKeys{
+          [&keys](int, Event event, FileParse::Json & parsed) {
+              if(event == Event::object_start)
+              {
+                  keys.emplace_back();
+              }
+              else if(event == Event::key)
+              {
+                  keys.back() = std::string(parsed.get_ref<const FileParse::Json::string_t &>());
+              }
+              else if(event == Event::object_end)
+              {
+                  keys.pop_back();
+              }
+              return true;
+          }};
+
+        // The partial document is discarded, so it is not allocated from the arena of the caller
+        const DocumentAllocation heap{nullptr};
+        try
+        {
+            [[maybe_unused]] const auto partial{FileParse::Json::parse(json, trackKeys)};
+        }
+        catch(const FileParse::Json::parse_error &)
+        {
+            // Expected, the keys are those open at the error
+        }
+
+        std::string nodePath;
+        for(const auto & key : keys)
+        {
+            if(!key.empty())
+            {
+                nodePath += nodePath.empty() ? key : "/" + key;
+            }
+        }
+        return nodePath;
+    }
+}   // namespace
+
+FileParse::Expected<JSONNodeAdapter> tryGetJSONTopNodeFromString(std::string_view json,
+                                                                 std::string_view topNodeName)
+{
+    auto document{makeDocument()};
+    const DocumentAllocation allocation{document.get()};
+    auto & root{document->root};
+    try
+    {
+        root = FileParse::Json::parse(json);
+    }
+    catch(const FileParse::Json::parse_error & exception)
+    {
+        FileParse::LoadError error;
+        error.message = exception.what();
+        // The byte of the exception is the one based position of the last character read
+        error.offset = exception.byte > 0u ? exception.byte - 1u : 0u;
+        error.nodePath = errorNodePath(json);
+        FileParse::setLineAndColumn(error, json);
+        return error;
+    }
+
+    const auto topNode{root.find(topNodeName)};
+    if(topNode == root.end())
+    {
+        const std::string topNodeStr(topNodeName);
+        FileParse::LoadError error;
+        error.category = FileParse::ErrorCategory::MissingNode;
+        error.message = "Top node " + topNodeStr + " not found";
+        error.nodePath = topNodeStr;
+        return error;
+    }
+
+    auto impl = std::make_shared<JSONNodeAdapter::Impl>(document, topNode.key());
+    impl->jsonPtr_ = &*topNode;
+
+    return JSONNodeAdapter(std::move(impl));
+}
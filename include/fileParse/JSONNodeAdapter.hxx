@@ -4,20 +4,66 @@
 
 #pragma once
 
+#include <cstdint>
+#include <iosfwd>
+#include <map>
 #include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
 
+#include "Expected.hxx"
 #include "INodeAdapter.hxx"
+#include "TagTable.hxx"
 #include <nlohmann/json_fwd.hpp>
 
+#ifdef FILEPARSE_JSON_ARENA
+#    include "Arena.hxx"
+
+namespace FileParse
+{
+    /// The string type of keys and string values of Json, allocated from the same arena as the
+    /// nodes, so that strings longer than the short-string buffer are not separate heap blocks.
+    using JsonString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+    /// The JSON value type used by JSONNodeAdapter. Built with FILEPARSE_JSON_ARENA, it is
+    /// nlohmann::json with nodes and strings allocated by ArenaAllocator, so that a document
+    /// lives in the arena of that document.
+    using Json = nlohmann::basic_json<std::map,
+                                      std::vector,
+                                      JsonString,
+                                      bool,
+                                      std::int64_t,
+                                      std::uint64_t,
+                                      double,
+                                      ArenaAllocator>;
+}   // namespace FileParse
+#else
+namespace FileParse
+{
+    /// The JSON value type used by JSONNodeAdapter.
+    using Json = nlohmann::json;
+
+    /// The string type of keys and string values of Json.
+    using JsonString = std::string;
+}   // namespace FileParse
+#endif
+
 /// Class JSONNodeAdapter
 /// Adapts nlohmann::json for use with FileParse functionalities.
+/// Built with FILEPARSE_JSON_ARENA, documents created by the factory functions below allocate
+/// their nodes from an arena owned by the document, see setJSONArenaSize. Adapters of a document
+/// keep the document alive.
+/// Const member functions only read the document and may be called concurrently from multiple
+/// threads. Modifying a document while it is read from other threads is not supported.
 class JSONNodeAdapter : public INodeAdapter<JSONNodeAdapter>
 {
 public:
     /// Constructor for JSONNodeAdapter.
-    /// @param jsonPtr A pointer to nlohmann::json to be adapted.
+    /// @param jsonPtr A pointer to the JSON value to be adapted. It is not owned by the adapter
+    /// and nodes added through the adapter are allocated from the heap.
     /// @param key The key name for this node (empty for root values).
-    explicit JSONNodeAdapter(nlohmann::json * jsonPtr, std::string key = "");
+    explicit JSONNodeAdapter(FileParse::Json * jsonPtr, std::string key = "");
 
     /// Checks if the node is empty.
     /// @return True if the node is empty, false otherwise.
@@ -63,11 +109,37 @@ public:
     /// @return The newly added child node adapter.
     [[nodiscard]] JSONNodeAdapter addChild(std::string_view name) override;
 
+    /// Checks if the adapter supports createDetachedNode and appendChild.
+    /// @return Always true.
+    [[nodiscard]] bool supportsDetachedNodes() const override;
+
+    /// Creates a new top node that is not part of this document.
+    /// @param name The name of the new node.
+    /// @return The detached node adapter.
+    [[nodiscard]] JSONNodeAdapter createDetachedNode(std::string_view name) const override;
+
+    /// Moves a detached node and its subtree to the end of the child nodes. A repeated name is
+    /// converted to an array in the same way as addChild does.
+    /// @param child The node created by createDetachedNode.
+    void appendChild(JSONNodeAdapter & child) override;
+
     /// Adds text content to the node.
     /// @param text The text to add to the node.
     void addText(std::string_view text) override;
 
-    /// Writes the node's content to a file.
+    /// Adds a child holding packed numeric values as a native JSON array of numbers.
+    /// @param name The name of the child.
+    /// @param values Whitespace separated numeric values.
+    void addPackedValues(std::string_view name, std::string_view values) override;
+
+    /// Gets packed numeric values from a child JSON array of numbers (or a string holding them).
+    /// @param name The name of the child.
+    /// @return Whitespace separated numeric values, or std::nullopt if the child does not exist.
+    [[nodiscard]] std::optional<std::string>
+      getPackedValues(std::string_view name) const override;
+
+    /// Writes the node's content to a file. The file is replaced atomically, so it is never
+    /// left with partial content.
     /// @param fileName The name of the file to write the content to.
     /// @return 0 on success, non-zero on failure.
     [[nodiscard]] int writeToFile(std::string_view fileName) const;
@@ -93,13 +165,32 @@ private:
     // Private constructor for factory functions
     explicit JSONNodeAdapter(std::shared_ptr<Impl> impl);
 
+    /// Wraps a node of the same document, keeping the document alive.
+    [[nodiscard]] JSONNodeAdapter makeDocumentNode(const FileParse::Json & json,
+                                                   std::string_view key) const;
+
     friend JSONNodeAdapter createJSONTopNode(std::string_view topNodeName);
     friend std::optional<JSONNodeAdapter> getJSONTopNodeFromFile(std::string_view fileName,
                                                                   std::string_view topNodeName);
     friend std::optional<JSONNodeAdapter> getJSONTopNodeFromString(std::string_view json,
                                                                     std::string_view topNodeName);
+    friend std::optional<JSONNodeAdapter> getJSONTopNodeFromStream(std::istream & input,
+                                                                    std::string_view topNodeName);
+    friend FileParse::Expected<JSONNodeAdapter>
+      tryGetJSONTopNodeFromString(std::string_view json, std::string_view topNodeName);
 };
 
+/// Sets the initial size of the arena that the nodes of JSON documents created afterwards are
+/// allocated from. The arena grows as needed and is released with its document in one piece
+/// instead of node by node. Nodes added to a document keep coming from its arena, so documents
+/// that are modified heavily after parsing may grow larger than with the heap. Has no effect
+/// unless FileParse is built with FILEPARSE_JSON_ARENA.
+/// @param initialBytes The initial arena size, or 0 to allocate every node from the heap.
+void setJSONArenaSize(size_t initialBytes);
+
+/// @return The initial arena size of new JSON documents, or 0 if they use the heap.
+[[nodiscard]] size_t getJSONArenaSize();
+
 /// Creates a top-level JSON node with a specified name.
 /// @param topNodeName The name of the top node.
 /// @return The top node adapter.
@@ -118,3 +209,19 @@ private:
 /// @return An optional containing the top node adapter if successful, std::nullopt otherwise.
 [[nodiscard]] std::optional<JSONNodeAdapter> getJSONTopNodeFromString(std::string_view json,
                                                                        std::string_view topNodeName);
+
+/// Retrieves the top-level JSON node from a string and describes why that failed. Syntax errors
+/// are reported without throwing and carry the keys of the objects enclosing them.
+/// @param json The JSON string to parse.
+/// @param topNodeName The name of the top node to retrieve.
+/// @return The top node adapter, or the syntax error with its position, or a missing node error.
+[[nodiscard]] FileParse::Expected<JSONNodeAdapter>
+  tryGetJSONTopNodeFromString(std::string_view json, std::string_view topNodeName);
+
+/// Retrieves the top-level JSON node from a stream. The document is tokenized while it is read,
+/// so a stream that is still being filled by another thread is parsed as its data arrives.
+/// @param input The stream containing the JSON data.
+/// @param topNodeName The name of the top node to retrieve.
+/// @return An optional containing the top node adapter if successful, std::nullopt otherwise.
+[[nodiscard]] std::optional<JSONNodeAdapter> getJSONTopNodeFromStream(std::istream & input,
+                                                                       std::string_view topNodeName);
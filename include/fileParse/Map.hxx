@@ -70,16 +70,18 @@ namespace FileParse
                              std::string_view childNodeName,
                              MapType & map)
     {
-        const auto childNodes{node.getChildNodesByName(childNodeName.data())};
+        reserveAdditional(map, node.countChildren(childNodeName));
+
+        const auto childNodes{node.getChildNodesByName(childNodeName)};
         for(const auto & childNode : childNodes)
         {
-            typename MapType::key_type key;
-            typename MapType::mapped_type value;
+            auto key{Detail::makeElement<typename MapType::key_type>(map)};
+            auto value{Detail::makeElement<typename MapType::mapped_type>(map)};
 
             childNode >> key;
             childNode >> value;
 
-            map[key] = value;
+            map.insert_or_assign(std::move(key), std::move(value));
         }
 
         return node;
@@ -134,16 +136,18 @@ namespace FileParse
                              const MapStructure & mapStructure,
                              MapType & map)
     {
+        reserveAdditional(map, node.countChildren(mapStructure.childsName));
+
         const auto childNodes{node.getChildNodesByName(mapStructure.childsName)};
         for(const auto & childNode : childNodes)
         {
-            typename MapType::key_type key;
-            typename MapType::mapped_type value;
+            auto key{Detail::makeElement<typename MapType::key_type>(map)};
+            auto value{Detail::makeElement<typename MapType::mapped_type>(map)};
 
             childNode >> Child{mapStructure.keyName, key};
             childNode >> Child{mapStructure.valueName, value};
 
-            map[key] = value;
+            map.insert_or_assign(std::move(key), std::move(value));
         }
 
         return node;
@@ -191,6 +195,7 @@ namespace FileParse
       const NodeAdapter & node, MapType & map, std::function<EnumType(std::string_view)> converter)
     {
         const auto & childNodes{node.getChildNodes()};
+        reserveAdditional(map, childNodes.size());
         for(const auto & childNode : childNodes)
         {
             if(!childNode.isEmpty())
@@ -0,0 +1,117 @@
+/// File: NodePath.hxx
+/// @brief Provides the sequence of node names that leads to a child, holding short sequences
+///        inline so that describing a field does not allocate.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace FileParse
+{
+    /// Names of the nodes leading from a node to one of its descendants. The names are views, so
+    /// the strings they refer to must outlive the path; string literals always do. Paths of up to
+    /// inlineCapacity names are stored inline and may be built at compile time, longer paths keep
+    /// their names on the heap.
+    class NodePath
+    {
+    public:
+        static constexpr size_t inlineCapacity{4u};
+
+        /// The empty path.
+        constexpr NodePath() noexcept = default;
+
+        /// @param name The name of a direct child.
+        constexpr NodePath(std::string_view name) noexcept : inline_{name}, size_{1u}
+        {}
+
+        /// @param name The name of a direct child.
+        constexpr NodePath(const char * name) noexcept : NodePath(std::string_view{name})
+        {}
+
+        /// @param name The name of a direct child.
+        NodePath(const std::string & name) noexcept : NodePath(std::string_view{name})
+        {}
+
+        /// @param names The names of the nodes leading to the descendant, outermost first.
+        constexpr NodePath(std::initializer_list<std::string_view> names)
+        {
+            assign(names.begin(), names.end());
+        }
+
+        /// @param names The names of the nodes leading to the descendant, outermost first.
+        NodePath(const std::vector<std::string> & names)
+        {
+            assign(names.begin(), names.end());
+        }
+
+        [[nodiscard]] constexpr const std::string_view * begin() const noexcept
+        {
+            return overflow_.empty() ? inline_.data() : overflow_.data();
+        }
+
+        [[nodiscard]] constexpr const std::string_view * end() const noexcept
+        {
+            return begin() + size_;
+        }
+
+        [[nodiscard]] constexpr size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return size_ == 0u;
+        }
+
+        [[nodiscard]] constexpr std::string_view operator[](size_t index) const noexcept
+        {
+            return begin()[index];
+        }
+
+        [[nodiscard]] constexpr std::string_view front() const noexcept
+        {
+            return *begin();
+        }
+
+        [[nodiscard]] constexpr std::string_view back() const noexcept
+        {
+            return end()[-1];
+        }
+
+    private:
+        template<typename Iterator>
+        constexpr void assign(Iterator first, Iterator last)
+        {
+            size_ = static_cast<size_t>(std::distance(first, last));
+            if(size_ <= inlineCapacity)
+            {
+                std::copy(first, last, inline_.begin());
+            }
+            else
+            {
+                overflow_.assign(first, last);
+            }
+        }
+
+        std::array<std::string_view, inlineCapacity> inline_{};
+        size_t size_{0u};
+        std::vector<std::string_view> overflow_;
+    };
+
+    /// True for the types owning the names they hold, std::string and std::vector<std::string>.
+    /// A NodePath built from a temporary of them would view destroyed strings, so the wrappers
+    /// holding a NodePath delete their constructors for such temporaries.
+    /// @tparam Names The type deduced for a forwarding reference, a non-reference for rvalues.
+    template<typename Names>
+    inline constexpr bool owns_node_names_v =
+      std::is_same_v<Names, std::string> || std::is_same_v<Names, std::vector<std::string>>;
+}   // namespace FileParse
@@ -0,0 +1,386 @@
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define FILEPARSE_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define FILEPARSE_NEON
+#endif
+
+#include "NumberParser.hxx"
+
+namespace FileParse
+{
+    namespace
+    {
+        bool isDelimiter(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == ',';
+        }
+
+        bool isDigit(char c)
+        {
+            return static_cast<unsigned char>(c - '0') < 10u;
+        }
+
+#if defined(FILEPARSE_SSE2) || defined(FILEPARSE_NEON)
+        constexpr std::ptrdiff_t blockSize{16};
+
+#    if defined(FILEPARSE_SSE2)
+        // One bit per byte
+        constexpr int bitsPerByte{1};
+        constexpr uint64_t fullBlockMask{0xFFFF};
+
+        uint64_t delimiterMask(const char * p)
+        {
+            const __m128i block{_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))};
+            __m128i matches{_mm_cmpeq_epi8(block, _mm_set1_epi8(' '))};
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8('\t')));
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8('\n')));
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8('\r')));
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, _mm_set1_epi8(',')));
+            return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(matches)));
+        }
+#    else
+        // NEON has no movemask; narrowing the comparison result gives four bits per byte
+        constexpr int bitsPerByte{4};
+        constexpr uint64_t fullBlockMask{~uint64_t{0}};
+
+        uint64_t delimiterMask(const char * p)
+        {
+            const uint8x16_t block{vld1q_u8(reinterpret_cast<const uint8_t *>(p))};
+            uint8x16_t matches{vceqq_u8(block, vdupq_n_u8(' '))};
+            matches = vorrq_u8(matches, vceqq_u8(block, vdupq_n_u8('\t')));
+            matches = vorrq_u8(matches, vceqq_u8(block, vdupq_n_u8('\n')));
+            matches = vorrq_u8(matches, vceqq_u8(block, vdupq_n_u8('\r')));
+            matches = vorrq_u8(matches, vceqq_u8(block, vdupq_n_u8(',')));
+            const uint8x8_t narrowed{vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)};
+            return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+        }
+#    endif
+#endif
+
+        const char * skipDelimiters(const char * first, const char * last)
+        {
+#if defined(FILEPARSE_SSE2) || defined(FILEPARSE_NEON)
+            while(last - first >= blockSize)
+            {
+                if(const auto mask{~delimiterMask(first) & fullBlockMask}; mask != 0u)
+                {
+                    return first + std::countr_zero(mask) / bitsPerByte;
+                }
+                first += blockSize;
+            }
+#endif
+            while(first != last && isDelimiter(*first))
+            {
+                ++first;
+            }
+            return first;
+        }
+
+        const char * findDelimiter(const char * first, const char * last)
+        {
+#if defined(FILEPARSE_SSE2) || defined(FILEPARSE_NEON)
+            while(last - first >= blockSize)
+            {
+                if(const auto mask{delimiterMask(first)}; mask != 0u)
+                {
+                    return first + std::countr_zero(mask) / bitsPerByte;
+                }
+                first += blockSize;
+            }
+#endif
+            while(first != last && !isDelimiter(*first))
+            {
+                ++first;
+            }
+            return first;
+        }
+
+        // Checks whether all eight bytes of the chunk are decimal digits.
+        bool isEightDigits(uint64_t chunk)
+        {
+            return ((chunk & 0xF0F0F0F0F0F0F0F0) == 0x3030303030303030)
+                   && (((chunk + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0)
+                       == 0x3030303030303030);
+        }
+
+        // Converts eight ASCII digits into their value with three multiplications instead of
+        // eight. The bytes are expected in memory order on a little endian machine.
+        uint64_t eightDigitsValue(uint64_t chunk)
+        {
+            chunk = (chunk & 0x0F0F0F0F0F0F0F0F) * 2561 >> 8;
+            chunk = (chunk & 0x00FF00FF00FF00FF) * 6553601 >> 16;
+            return (chunk & 0x0000FFFF0000FFFF) * 42949672960001 >> 32;
+        }
+
+        // Accumulates the digits starting at first into mantissa. Returns false if more digits
+        // are present than can be represented exactly.
+        bool accumulateDigits(const char *& first,
+                              const char * last,
+                              uint64_t & mantissa,
+                              int & digitCount)
+        {
+            constexpr int maxDigits{19};
+
+            if constexpr(std::endian::native == std::endian::little)
+            {
+                while(last - first >= 8 && digitCount + 8 <= maxDigits)
+                {
+                    uint64_t chunk;
+                    std::memcpy(&chunk, first, sizeof(chunk));
+                    if(!isEightDigits(chunk))
+                    {
+                        break;
+                    }
+                    mantissa = mantissa * 100000000 + eightDigitsValue(chunk);
+                    digitCount += 8;
+                    first += 8;
+                }
+            }
+
+            while(first != last && isDigit(*first))
+            {
+                if(digitCount == maxDigits)
+                {
+                    return false;
+                }
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*first - '0');
+                ++digitCount;
+                ++first;
+            }
+
+            return true;
+        }
+
+        // Clinger's fast path: when the decimal mantissa and the power of ten are both exactly
+        // representable as doubles, a single multiplication or division is correctly rounded.
+        bool parseDoubleFast(const char * first, const char * last, double & value)
+        {
+            constexpr std::array<double, 23> powersOfTen{
+              1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+              1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+            constexpr uint64_t maxExactMantissa{uint64_t{1} << 53};
+
+            const bool negative{*first == '-'};
+            if(*first == '-' || *first == '+')
+            {
+                ++first;
+            }
+
+            uint64_t mantissa{0};
+            int digitCount{0};
+
+            const char * integerStart{first};
+            if(!accumulateDigits(first, last, mantissa, digitCount))
+            {
+                return false;
+            }
+            bool hasDigits{first != integerStart};
+
+            int exponent{0};
+            if(first != last && *first == '.')
+            {
+                ++first;
+                const char * fractionStart{first};
+                if(!accumulateDigits(first, last, mantissa, digitCount))
+                {
+                    return false;
+                }
+                exponent -= static_cast<int>(first - fractionStart);
+                hasDigits = hasDigits || first != fractionStart;
+            }
+
+            if(!hasDigits)
+            {
+                return false;
+            }
+
+            if(first != last && (*first == 'e' || *first == 'E'))
+            {
+                ++first;
+                const bool negativeExponent{first != last && *first == '-'};
+                if(first != last && (*first == '-' || *first == '+'))
+                {
+                    ++first;
+                }
+                const char * exponentStart{first};
+                int explicitExponent{0};
+                while(first != last && isDigit(*first))
+                {
+                    if(explicitExponent > 10000)
+                    {
+                        return false;
+                    }
+                    explicitExponent = explicitExponent * 10 + (*first - '0');
+                    ++first;
+                }
+                if(first == exponentStart)
+                {
+                    return false;
+                }
+                exponent += negativeExponent ? -explicitExponent : explicitExponent;
+            }
+
+            if(first != last || mantissa > maxExactMantissa || exponent < -22 || exponent > 22)
+            {
+                return false;
+            }
+
+            value = static_cast<double>(mantissa);
+            value = exponent < 0 ? value / powersOfTen[static_cast<size_t>(-exponent)]
+                                 : value * powersOfTen[static_cast<size_t>(exponent)];
+            if(negative)
+            {
+                value = -value;
+            }
+
+            return true;
+        }
+
+        [[noreturn]] void throwInvalidValue(const char * first, const char * last)
+        {
+            throw std::invalid_argument("Invalid numeric value: " + std::string(first, last));
+        }
+
+        double parseDouble(const char * first, const char * last)
+        {
+            double value{0};
+            if(parseDoubleFast(first, last, value))
+            {
+                return value;
+            }
+
+            // Long mantissas, large exponents, inf and nan go through the C library
+            const std::string token(first, last);
+            char * end{nullptr};
+            value = std::strtod(token.c_str(), &end);
+            if(end != token.c_str() + token.size())
+            {
+                throwInvalidValue(first, last);
+            }
+
+            return value;
+        }
+
+        template<typename T>
+        T parseInt(const char * first, const char * last)
+        {
+            const char * start{first};
+            if(first != last && *first == '+')
+            {
+                ++first;
+                if(first != last && *first == '-')
+                {
+                    throwInvalidValue(start, last);
+                }
+            }
+
+            T value{0};
+            const auto [end, error]{std::from_chars(first, last, value)};
+            if(error == std::errc::result_out_of_range)
+            {
+                throw std::out_of_range("Numeric value out of range: "
+                                        + std::string(start, last));
+            }
+            if(error != std::errc() || end != last)
+            {
+                throwInvalidValue(start, last);
+            }
+
+            return value;
+        }
+
+        template<typename T, typename Parser>
+        size_t parseValues(std::string_view text, std::span<T> values, Parser parser)
+        {
+            const char * current{text.data()};
+            const char * last{text.data() + text.size()};
+
+            size_t count{0};
+            while(count < values.size())
+            {
+                current = skipDelimiters(current, last);
+                if(current == last)
+                {
+                    break;
+                }
+                const char * tokenEnd{findDelimiter(current, last)};
+                values[count++] = parser(current, tokenEnd);
+                current = tokenEnd;
+            }
+
+            return count;
+        }
+
+        template<typename T>
+        size_t parseIntValues(std::string_view text, std::span<T> values)
+        {
+            return parseValues(text, values, parseInt<T>);
+        }
+    }   // namespace
+
+    size_t countValues(std::string_view text)
+    {
+        const char * current{text.data()};
+        const char * last{text.data() + text.size()};
+
+        size_t count{0};
+        for(;;)
+        {
+            current = skipDelimiters(current, last);
+            if(current == last)
+            {
+                break;
+            }
+            current = findDelimiter(current, last);
+            ++count;
+        }
+
+        return count;
+    }
+
+    size_t parseDoubles(std::string_view text, std::span<double> values)
+    {
+        return parseValues(text, values, parseDouble);
+    }
+
+    size_t parseInts(std::string_view text, std::span<int> values)
+    {
+        return parseIntValues(text, values);
+    }
+
+    size_t parseInts(std::string_view text, std::span<long> values)
+    {
+        return parseIntValues(text, values);
+    }
+
+    size_t parseInts(std::string_view text, std::span<long long> values)
+    {
+        return parseIntValues(text, values);
+    }
+
+    size_t parseInts(std::string_view text, std::span<unsigned> values)
+    {
+        return parseIntValues(text, values);
+    }
+
+    size_t parseInts(std::string_view text, std::span<unsigned long> values)
+    {
+        return parseIntValues(text, values);
+    }
+
+    size_t parseInts(std::string_view text, std::span<unsigned long long> values)
+    {
+        return parseIntValues(text, values);
+    }
+}   // namespace FileParse
@@ -0,0 +1,38 @@
+/// File: NumberParser.hxx
+/// @brief Provides bulk parsing of numeric text (packed element text, JSON number arrays)
+///        into preallocated storage.
+
+#pragma once
+
+#include <string_view>
+#include <span>
+#include <cstddef>
+
+namespace FileParse
+{
+    /// Counts the values in text where values are separated by whitespace or commas.
+    /// @param text The text to be scanned.
+    /// @return The number of values found in the text.
+    extern size_t countValues(std::string_view text);
+
+    /// Parses values separated by whitespace or commas into doubles. Delimiter scanning is done
+    /// with SIMD (SSE2 or NEON) when available and digits are accumulated eight at a time.
+    /// @param text The text to be parsed.
+    /// @param values Storage for the parsed values. Parsing stops once it is full.
+    /// @return The number of values written.
+    /// @throws std::invalid_argument If a value is not a valid number.
+    extern size_t parseDoubles(std::string_view text, std::span<double> values);
+
+    /// Parses values separated by whitespace or commas into integers.
+    /// @param text The text to be parsed.
+    /// @param values Storage for the parsed values. Parsing stops once it is full.
+    /// @return The number of values written.
+    /// @throws std::invalid_argument If a value is not a valid integer.
+    /// @throws std::out_of_range If a value does not fit into the integer type.
+    extern size_t parseInts(std::string_view text, std::span<int> values);
+    extern size_t parseInts(std::string_view text, std::span<long> values);
+    extern size_t parseInts(std::string_view text, std::span<long long> values);
+    extern size_t parseInts(std::string_view text, std::span<unsigned> values);
+    extern size_t parseInts(std::string_view text, std::span<unsigned long> values);
+    extern size_t parseInts(std::string_view text, std::span<unsigned long long> values);
+}   // namespace FileParse
@@ -0,0 +1,219 @@
+/// File: Packed.hxx
+/// @brief Provides the Packed wrapper and helpers used to serialize sequences of numbers
+///        into a single node instead of one child node per value.
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "Common.hxx"
+#include "Diagnostics.hxx"
+#include "NumberParser.hxx"
+
+namespace FileParse
+{
+    /// Represents a sequence of numbers that is stored packed into a single node. XML stores the
+    /// values as whitespace separated text of the last node, JSON as a native number array. Like
+    /// Child, it views its node names and is meant to be used as a temporary.
+    /// @tparam T The type of the container holding the numbers.
+    template<typename T>
+    struct Packed
+    {
+        /// Names of the nodes in the hierarchy leading to the packed node.
+        NodePath nodeNames;
+
+        /// Reference to the container with the numbers.
+        T & data;
+
+        /// Constructs a Packed object from a single node name, an initializer list of node names
+        /// or a vector of node names.
+        /// @param nodeNames The names of the nodes leading to the packed node.
+        /// @param data Reference to the container with the numbers.
+        Packed(NodePath nodeNames, T & data) : nodeNames(std::move(nodeNames)), data(data)
+        {}
+
+        template<typename Names>
+            requires owns_node_names_v<Names>
+        Packed(Names && nodeNames, T & data) = delete;
+    };
+
+    /// Formats numbers into whitespace separated text. Doubles follow the SerializationConfig
+    /// precision and scientific notation bounds. All values are written into a single buffer.
+    /// @tparam T The arithmetic type of the values.
+    /// @param values The values to be formatted.
+    /// @return The packed text.
+    template<typename T>
+    std::string formatPackedValues(std::span<const T> values)
+    {
+        static_assert(std::is_arithmetic_v<T>, "Packed values must be arithmetic!");
+
+        const auto & config{SerializationConfig::getInstance()};
+
+        std::string result;
+        if constexpr(std::is_same_v<T, double>)
+        {
+            formatDoubles(values,
+                          result,
+                          config.precision,
+                          config.scientificLowerBound,
+                          config.scientificUpperBound);
+        }
+        else
+        {
+            for(const auto & value : values)
+            {
+                if(!result.empty())
+                {
+                    result += ' ';
+                }
+                if constexpr(std::is_floating_point_v<T>)
+                {
+                    appendFormattedDouble(result,
+                                          static_cast<double>(value),
+                                          config.precision,
+                                          config.scientificLowerBound,
+                                          config.scientificUpperBound);
+                }
+                else
+                {
+                    result += std::to_string(value);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /// True for the arithmetic types that NumberParser decodes directly.
+    template<typename T>
+    inline constexpr bool has_number_parser_v =
+      std::is_same_v<T, double> || std::is_same_v<T, int> || std::is_same_v<T, long>
+      || std::is_same_v<T, long long> || std::is_same_v<T, unsigned>
+      || std::is_same_v<T, unsigned long> || std::is_same_v<T, unsigned long long>;
+
+    /// Parses whitespace (or comma) separated text into numbers. Types without a dedicated
+    /// parser (float, short, ...) are parsed as double or long long and converted.
+    /// @tparam T The arithmetic type of the values.
+    /// @param text The packed text.
+    /// @return The parsed values.
+    /// @throws std::invalid_argument If the text contains a token that is not a number.
+    /// @throws std::out_of_range If a value does not fit into T.
+    template<typename T>
+    std::vector<T> parsePackedValues(std::string_view text)
+    {
+        static_assert(std::is_arithmetic_v<T>, "Packed values must be arithmetic!");
+
+        if constexpr(has_number_parser_v<T>)
+        {
+            std::vector<T> values(countValues(text));
+            if constexpr(std::is_same_v<T, double>)
+            {
+                parseDoubles(text, values);
+            }
+            else
+            {
+                parseInts(text, values);
+            }
+            return values;
+        }
+        else
+        {
+            using Parsed = std::conditional_t<std::is_floating_point_v<T>, double, long long>;
+            const auto parsed{parsePackedValues<Parsed>(text)};
+
+            std::vector<T> values;
+            values.reserve(parsed.size());
+            for(const auto value : parsed)
+            {
+                // Infinity and NaN convert to any floating point type; other values must fit
+                const bool fits{std::isfinite(static_cast<double>(value))
+                                  ? value >= static_cast<Parsed>(std::numeric_limits<T>::lowest())
+                                      && value <= static_cast<Parsed>(std::numeric_limits<T>::max())
+                                  : std::is_floating_point_v<T>};
+                if(!fits)
+                {
+                    throw std::out_of_range("Numeric value out of range: " + std::to_string(value));
+                }
+                values.push_back(static_cast<T>(value));
+            }
+            return values;
+        }
+    }
+
+    /// Parses packed text like parsePackedValues. With an active DiagnosticsSink, text that is not
+    /// a list of numbers is reported instead of throwing.
+    /// @tparam T The arithmetic type of the values.
+    /// @param text The packed text.
+    /// @return The parsed values, or std::nullopt if the failure was reported.
+    template<typename T>
+    std::optional<std::vector<T>> parsePackedValuesOrReport(std::string_view text)
+    {
+        if(Detail::diagnosticsContext().sink == nullptr)
+        {
+            return parsePackedValues<T>(text);
+        }
+
+        try
+        {
+            return parsePackedValues<T>(text);
+        }
+        catch(const std::invalid_argument &)
+        {
+            reportConversionFailure(text, "Invalid number");
+        }
+        catch(const std::out_of_range &)
+        {
+            reportConversionFailure(text, "Value out of range");
+        }
+        return std::nullopt;
+    }
+
+    /// Writes numbers as packed text into the last node of the hierarchy.
+    /// @tparam NodeAdapter The type of the node adapter.
+    /// @tparam T The arithmetic type of the values.
+    /// @param node The node to serialize into.
+    /// @param nodeNames The node hierarchy leading to the packed node.
+    /// @param values The values to be written.
+    /// @return Reference to the updated node.
+    template<typename NodeAdapter, typename T>
+    NodeAdapter & serializePacked(NodeAdapter & node,
+                                  const NodePath & nodeNames,
+                                  std::span<const T> values)
+    {
+        if(nodeNames.empty() || values.empty())
+            return node;
+
+        auto parentNode{insertAllButLastChild(node, nodeNames)};
+        parentNode.addPackedValues(nodeNames.back(), formatPackedValues(values));
+
+        return node;
+    }
+
+    /// Reads the packed text of the last node of the hierarchy.
+    /// @tparam NodeAdapter The type of the node adapter.
+    /// @param node The node to deserialize from.
+    /// @param nodeNames The node hierarchy leading to the packed node.
+    /// @return The packed text, or std::nullopt if the node does not exist.
+    template<typename NodeAdapter>
+    std::optional<std::string> findPackedValues(const NodeAdapter & node,
+                                                const NodePath & nodeNames)
+    {
+        if(nodeNames.empty())
+            return std::nullopt;
+
+        if(auto parentNode{findParentOfLastTag(node, nodeNames)}; parentNode.has_value())
+        {
+            return parentNode->getPackedValues(nodeNames.back());
+        }
+
+        return std::nullopt;
+    }
+}   // namespace FileParse
@@ -0,0 +1,333 @@
+/// File: Parallel.hxx
+/// @brief Provides the parallel loops used by the batch loading and parallel
+///        serialization functions. All of them run on an Executor.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "NodePath.hxx"
+#include "Scheduler.hxx"
+
+namespace FileParse
+{
+    /// Determines how many threads should work on a number of tasks.
+    /// @param requested The requested number of threads. Zero selects the hardware concurrency.
+    /// @param tasks The number of tasks to be processed.
+    /// @return The number of threads, at least one and never more than the number of tasks.
+    inline size_t workerCount(size_t requested, size_t tasks)
+    {
+        if(requested == 0u)
+        {
+            requested = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        return std::max<size_t>(1u, std::min(requested, tasks));
+    }
+
+    namespace Detail
+    {
+        /// State shared between the caller of parallelFor and its helper tasks. Helper tasks may
+        /// start after the loop has finished, so the state outlives the call.
+        struct ParallelForState
+        {
+            std::mutex mutex;
+            std::condition_variable helpersDone;
+            size_t activeHelpers{0u};
+            bool closed{false};
+            std::atomic<size_t> nextIndex{0u};
+            std::atomic<bool> failed{false};
+            std::exception_ptr firstError;
+        };
+    }   // namespace Detail
+
+    /// Calls function(i) for every index in [0, count) on the executor. Indices are handed out one
+    /// at a time, so tasks of uneven cost balance out. The calling thread takes part in the work
+    /// and only waits for helper tasks that already started, so the function may be called from
+    /// a task of the same executor without deadlocking.
+    /// @param executor The executor running the helper tasks.
+    /// @param count The number of tasks.
+    /// @param threadCount The number of threads including the calling one. Zero uses all threads
+    /// of the executor.
+    /// @param function The task, called with the index of the task.
+    /// @throws The first exception thrown by a task, after all threads have stopped. Tasks that
+    /// were not started yet are skipped.
+    template<typename Function>
+    void parallelFor(Executor & executor, size_t count, size_t threadCount, Function && function)
+    {
+        const auto workers{
+          workerCount(threadCount == 0u ? executor.concurrency() + 1u : threadCount, count)};
+        if(workers == 1u)
+        {
+            for(size_t i = 0u; i < count; ++i)
+            {
+                function(i);
+            }
+            return;
+        }
+
+        auto state{std::make_shared<Detail::ParallelForState>()};
+
+        auto work = [state, count, &function]() {
+            for(size_t i = state->nextIndex++; i < count && !state->failed;
+                i = state->nextIndex++)
+            {
+                try
+                {
+                    function(i);
+                }
+                catch(...)
+                {
+                    std::scoped_lock lock{state->mutex};
+                    if(!state->firstError)
+                    {
+                        state->firstError = std::current_exception();
+                    }
+                    state->failed = true;
+                }
+            }
+        };
+
+        for(size_t i = 1u; i < workers; ++i)
+        {
+            executor.execute([state, work]() {
+                {
+                    std::scoped_lock lock{state->mutex};
+                    if(state->closed)
+                    {
+                        return;
+                    }
+                    ++state->activeHelpers;
+                }
+                work();
+                {
+                    std::scoped_lock lock{state->mutex};
+                    --state->activeHelpers;
+                }
+                state->helpersDone.notify_all();
+            });
+        }
+        work();
+
+        std::unique_lock lock{state->mutex};
+        state->closed = true;
+        state->helpersDone.wait(lock, [&] { return state->activeHelpers == 0u; });
+
+        if(state->firstError)
+        {
+            std::rethrow_exception(state->firstError);
+        }
+    }
+
+    /// Calls function(i) for every index in [0, count) on the default executor.
+    /// @param count The number of tasks.
+    /// @param threadCount The number of threads including the calling one. Zero uses all threads
+    /// of the executor.
+    /// @param function The task, called with the index of the task.
+    /// @throws The first exception thrown by a task, after all threads have stopped.
+    template<typename Function>
+    void parallelFor(size_t count, size_t threadCount, Function && function)
+    {
+        parallelFor(*defaultExecutor(), count, threadCount, std::forward<Function>(function));
+    }
+
+    /// Splits [0, count) into contiguous chunks and calls function(begin, end) for every chunk on
+    /// up to threadCount threads. A few chunks per thread keep all threads busy when chunks take
+    /// different amounts of time.
+    /// @param count The number of items.
+    /// @param threadCount The number of threads. Zero uses all threads of the default executor.
+    /// @param function The task, called with the first and one past the last index of a chunk.
+    /// @throws The first exception thrown by a task, after all threads have stopped.
+    template<typename Function>
+    void parallelForChunks(size_t count, size_t threadCount, Function && function)
+    {
+        constexpr size_t chunksPerThread{4u};
+
+        const auto workers{workerCount(
+          threadCount == 0u ? defaultExecutor()->concurrency() + 1u : threadCount, count)};
+        const auto chunkCount{std::min(count, workers * chunksPerThread)};
+
+        parallelFor(chunkCount, workers, [&](size_t chunk) {
+            function(chunk * count / chunkCount, (chunk + 1u) * count / chunkCount);
+        });
+    }
+
+    /// Calls function(child, index) for every child node with the given name on the default
+    /// executor. The index is the position of the child among its siblings of that name. Works
+    /// with every node adapter whose const methods are safe to call from multiple threads.
+    /// @param node The parent node.
+    /// @param name The name of the child nodes.
+    /// @param function The task, called with the child node and its index.
+    /// @param threadCount The number of threads. Zero uses all threads of the default executor.
+    /// @throws The first exception thrown by a task, after all threads have stopped.
+    template<typename NodeAdapter, typename Function>
+    void parallelForEachChild(const NodeAdapter & node,
+                              std::string_view name,
+                              Function && function,
+                              size_t threadCount = 0u)
+    {
+        const auto children{node.getChildNodesByName(name)};
+        parallelFor(children.size(), threadCount, [&](size_t index) {
+            function(children[index], index);
+        });
+    }
+
+    /// Limits the number of bytes that are processed at the same time. Threads acquire the size
+    /// of their work before starting it and release it once done.
+    class ByteBudget
+    {
+    public:
+        /// @param capacity The maximum number of bytes in flight.
+        explicit ByteBudget(size_t capacity) : capacity_(std::max<size_t>(1u, capacity))
+        {}
+
+        ByteBudget(const ByteBudget &) = delete;
+        ByteBudget & operator=(const ByteBudget &) = delete;
+
+        /// Blocks until the bytes fit into the budget. Requests larger than the capacity are
+        /// clamped to it, so they run once nothing else is in flight.
+        /// @param bytes The number of bytes requested.
+        /// @return The number of bytes actually acquired, to be passed to release.
+        size_t acquire(size_t bytes)
+        {
+            bytes = std::min(bytes, capacity_);
+
+            std::unique_lock lock{mutex_};
+            released_.wait(lock, [&] { return used_ + bytes <= capacity_; });
+            used_ += bytes;
+
+            return bytes;
+        }
+
+        /// Returns bytes to the budget.
+        /// @param bytes The number of bytes returned by acquire.
+        void release(size_t bytes)
+        {
+            {
+                std::scoped_lock lock{mutex_};
+                used_ -= bytes;
+            }
+            released_.notify_all();
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable released_;
+        size_t capacity_;
+        size_t used_{0u};
+    };
+
+    /// Queue with a fixed capacity connecting a producing and a consuming thread. Producers block
+    /// while the queue is full, consumers block while it is empty. Closing the queue wakes up both
+    /// sides: pending items can still be popped, further pushes are rejected.
+    /// @tparam T The type of the queued items.
+    template<typename T>
+    class BoundedQueue
+    {
+    public:
+        /// @param capacity The maximum number of queued items.
+        explicit BoundedQueue(size_t capacity) : capacity_(std::max<size_t>(1u, capacity))
+        {}
+
+        BoundedQueue(const BoundedQueue &) = delete;
+        BoundedQueue & operator=(const BoundedQueue &) = delete;
+
+        /// Adds an item, waiting for free space if the queue is full.
+        /// @param item The item to add.
+        /// @return False if the queue was closed and the item was dropped.
+        bool push(T item)
+        {
+            {
+                std::unique_lock lock{mutex_};
+                changed_.wait(lock, [&] { return closed_ || items_.size() < capacity_; });
+                if(closed_)
+                {
+                    return false;
+                }
+                items_.push_back(std::move(item));
+            }
+            changed_.notify_all();
+            return true;
+        }
+
+        /// Removes the oldest item, waiting for one if the queue is empty.
+        /// @return The item, or std::nullopt once the queue is closed and empty.
+        std::optional<T> pop()
+        {
+            std::optional<T> item;
+            {
+                std::unique_lock lock{mutex_};
+                changed_.wait(lock, [&] { return closed_ || !items_.empty(); });
+                if(items_.empty())
+                {
+                    return std::nullopt;
+                }
+                item.emplace(std::move(items_.front()));
+                items_.pop_front();
+            }
+            changed_.notify_all();
+            return item;
+        }
+
+        /// Stops accepting items and wakes up all waiting threads.
+        void close()
+        {
+            {
+                std::scoped_lock lock{mutex_};
+                closed_ = true;
+            }
+            changed_.notify_all();
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable changed_;
+        std::deque<T> items_;
+        size_t capacity_;
+        bool closed_{false};
+    };
+
+    /// Represents a collection of sibling child nodes that is serialized and deserialized on
+    /// multiple threads. Elements are decoded into pre-sized storage and encoded into detached
+    /// nodes that are appended in order, so the result is identical to Child.
+    /// @tparam T The type of the container associated with the child nodes.
+    template<typename T>
+    struct ParallelChild
+    {
+        /// Names of the nodes in the hierarchy leading to the child nodes.
+        NodePath nodeNames;
+
+        /// Reference to the container associated with the child nodes.
+        T & data;
+
+        /// Number of threads encoding or decoding the child nodes. Zero uses all threads of the
+        /// default executor.
+        size_t threadCount{0u};
+
+        /// Constructs a ParallelChild object from a single node name, an initializer list of node
+        /// names or a vector of node names.
+        /// @param nodeNames The names of the nodes leading to the child nodes.
+        /// @param data Reference to the container associated with the nodes.
+        /// @param threadCount Optional number of threads (default zero, all executor threads).
+        ParallelChild(NodePath nodeNames, T & data, size_t threadCount = 0u) :
+            nodeNames(std::move(nodeNames)), data(data), threadCount(threadCount)
+        {}
+
+        template<typename Names>
+            requires owns_node_names_v<Names>
+        ParallelChild(Names && nodeNames, T & data, size_t threadCount = 0u) = delete;
+    };
+}   // namespace FileParse
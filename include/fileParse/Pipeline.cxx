@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <fstream>
+#include <memory>
+
+#include "Pipeline.hxx"
+
+namespace FileParse
+{
+    PipelinedFileReader::PipelinedFileReader(std::string_view fileName,
+                                             const PipelineOptions & options) :
+        chunks_(options.queueDepth)
+    {
+        auto file{std::make_unique<std::ifstream>(std::string(fileName), std::ios::binary)};
+        isOpen_ = file->is_open();
+        if(!isOpen_)
+        {
+            chunks_.close();
+            return;
+        }
+
+        const auto chunkSize{std::max<size_t>(1u, options.chunkSize)};
+        reader_ = std::thread([this, chunkSize, file = std::move(file)]() {
+            while(*file)
+            {
+                std::string chunk(chunkSize, '\0');
+                file->read(chunk.data(), static_cast<std::streamsize>(chunkSize));
+                if(file->bad())
+                {
+                    // A truncated document must not reach the parser
+                    failed_ = true;
+                    break;
+                }
+                chunk.resize(static_cast<size_t>(file->gcount()));
+                if(chunk.empty() || !chunks_.push(std::move(chunk)))
+                {
+                    break;
+                }
+            }
+            chunks_.close();
+        });
+    }
+
+    PipelinedFileReader::~PipelinedFileReader()
+    {
+        chunks_.close();
+        if(reader_.joinable())
+        {
+            reader_.join();
+        }
+    }
+
+    bool PipelinedFileReader::isOpen() const
+    {
+        return isOpen_;
+    }
+
+    std::optional<std::string> PipelinedFileReader::nextChunk()
+    {
+        return chunks_.pop();
+    }
+
+    void PipelinedFileReader::readRemaining(std::string & content)
+    {
+        while(auto chunk{nextChunk()})
+        {
+            content += chunk.value();
+        }
+    }
+
+    bool PipelinedFileReader::failed() const
+    {
+        return failed_;
+    }
+
+    ChunkStreamBuffer::ChunkStreamBuffer(PipelinedFileReader & reader, std::string firstChunk) :
+        reader_(reader), current_(std::move(firstChunk))
+    {
+        setg(current_.data(), current_.data(), current_.data() + current_.size());
+    }
+
+    ChunkStreamBuffer::int_type ChunkStreamBuffer::underflow()
+    {
+        while(gptr() == egptr())
+        {
+            auto chunk{reader_.nextChunk()};
+            if(!chunk.has_value())
+            {
+                return traits_type::eof();
+            }
+            current_ = std::move(chunk.value());
+            setg(current_.data(), current_.data(), current_.data() + current_.size());
+        }
+
+        return traits_type::to_int_type(*gptr());
+    }
+}   // namespace FileParse
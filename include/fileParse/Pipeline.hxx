@@ -0,0 +1,84 @@
+/// File: Pipeline.hxx
+/// @brief Provides a chunked file reader running on its own thread, so reading a file overlaps
+///        with parsing the chunks that already arrived.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "Parallel.hxx"
+
+namespace FileParse
+{
+    /// Options controlling the pipelined file loading.
+    struct PipelineOptions
+    {
+        /// Number of bytes read from the file at once.
+        size_t chunkSize{size_t{1u} * 1024u * 1024u};
+        /// Number of chunks buffered between the reading and the parsing thread. Together with
+        /// chunkSize it bounds the memory used ahead of the parser.
+        size_t queueDepth{4u};
+    };
+
+    /// Reads a file in chunks on a separate thread. The chunks are handed over through a bounded
+    /// queue, so the reader only runs ahead of the consumer by a limited amount.
+    class PipelinedFileReader
+    {
+    public:
+        /// Opens the file and starts reading it.
+        /// @param fileName The name of the file to read.
+        /// @param options The chunk size and the number of buffered chunks.
+        PipelinedFileReader(std::string_view fileName, const PipelineOptions & options = {});
+
+        /// Stops the reading thread and waits for it.
+        ~PipelinedFileReader();
+
+        PipelinedFileReader(const PipelinedFileReader &) = delete;
+        PipelinedFileReader & operator=(const PipelinedFileReader &) = delete;
+
+        /// @return True if the file was opened.
+        [[nodiscard]] bool isOpen() const;
+
+        /// Waits for the next chunk of the file.
+        /// @return The chunk, or std::nullopt once the whole file was consumed or reading failed.
+        [[nodiscard]] std::optional<std::string> nextChunk();
+
+        /// Reads all remaining chunks into one buffer.
+        /// @param content Receives the rest of the file at its end. Reserve the size of the file
+        /// beforehand to avoid reallocations.
+        void readRemaining(std::string & content);
+
+        /// @return True if reading stopped at an error before the end of the file. Decided once
+        /// nextChunk returned std::nullopt.
+        [[nodiscard]] bool failed() const;
+
+    private:
+        BoundedQueue<std::string> chunks_;
+        bool isOpen_{false};
+        std::atomic<bool> failed_{false};
+        std::thread reader_;
+    };
+
+    /// Stream buffer presenting the chunks of a PipelinedFileReader as one continuous input, so
+    /// stream based parsers tokenize the file while it is still being read.
+    class ChunkStreamBuffer : public std::streambuf
+    {
+    public:
+        /// @param reader The reader providing the chunks.
+        /// @param firstChunk Chunk already taken from the reader that is read first.
+        explicit ChunkStreamBuffer(PipelinedFileReader & reader, std::string firstChunk = {});
+
+    protected:
+        int_type underflow() override;
+
+    private:
+        PipelinedFileReader & reader_;
+        std::string current_;
+    };
+}   // namespace FileParse
@@ -0,0 +1,265 @@
+/// File: RecordPlan.hxx
+/// @brief Provides per-type decoding plans that map the tags of a record to its fields once, so
+///        that every record is then decoded in a single pass over its child nodes.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <set>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Common.hxx"
+
+namespace FileParse
+{
+    namespace Detail
+    {
+        /// Containers that Child fills from all child nodes of the same name.
+        template<typename T>
+        struct is_plan_sequence : std::false_type
+        {};
+
+        template<typename T, typename Allocator>
+        struct is_plan_sequence<std::vector<T, Allocator>> : std::true_type
+        {};
+
+        template<typename T, typename Compare, typename Allocator>
+        struct is_plan_sequence<std::set<T, Compare, Allocator>> : std::true_type
+        {};
+
+        /// Optional containers that Child creates once a child node of their name exists.
+        template<typename T>
+        struct is_plan_optional_sequence : std::false_type
+        {};
+
+        template<typename T>
+        struct is_plan_optional_sequence<std::optional<T>> : is_plan_sequence<T>
+        {};
+
+        /// Arrays, which Child decodes with their own rules for missing and surplus child nodes.
+        template<typename T>
+        struct is_plan_array : std::false_type
+        {};
+
+        template<typename T, size_t N>
+        struct is_plan_array<std::array<T, N>> : std::true_type
+        {};
+
+        template<typename T>
+        struct is_plan_array<std::optional<T>> : is_plan_array<T>
+        {};
+
+        /// Hash allowing lookups by std::string_view in maps keyed by strings.
+        struct TagHash
+        {
+            using is_transparent = void;
+
+            size_t operator()(std::string_view text) const noexcept
+            {
+                return std::hash<std::string_view>{}(text);
+            }
+        };
+    }   // namespace Detail
+
+    /// Decoding plan of a type whose fields are described by a fileParseFields function, usually
+    /// generated by FILEPARSE_FIELDS. The tags of all fields stored in direct child nodes are put
+    /// into a hash table once. Decoding then walks the child nodes of a record a single time and
+    /// dispatches every child to its field by tag, instead of searching the children once per
+    /// field. The result is the same as decoding each field through Child. Fields behind nested
+    /// node names, std::array fields and fields sharing the tag of an earlier field are decoded
+    /// through Child after the pass.
+    /// @tparam T The type of the records.
+    template<typename T>
+    class RecordPlan
+    {
+    public:
+        /// Field descriptions of the type.
+        static constexpr auto fields{fileParseFields(static_cast<const T *>(nullptr))};
+
+        /// Number of described fields.
+        static constexpr size_t fieldCount{
+          std::tuple_size_v<std::remove_const_t<decltype(fields)>>};
+
+        RecordPlan()
+        {
+            addFields(std::make_index_sequence<fieldCount>{});
+        }
+
+        /// @param tag The name of a direct child node.
+        /// @return The index of the field decoded from child nodes of that name, if any.
+        [[nodiscard]] std::optional<size_t> fieldIndex(std::string_view tag) const
+        {
+            if(const auto it{index_.find(tag)}; it != index_.end())
+            {
+                return it->second;
+            }
+            return std::nullopt;
+        }
+
+        /// Decodes a record from its node.
+        /// @tparam NodeAdapter The type of the node adapter.
+        /// @param node The node of the record.
+        /// @param value The record receiving the fields.
+        /// @return Const reference to the node.
+        template<typename NodeAdapter>
+        const NodeAdapter & decode(const NodeAdapter & node, T & value) const
+        {
+            return decode(node, value, std::make_index_sequence<fieldCount>{});
+        }
+
+    private:
+        template<size_t... I>
+        void addFields(std::index_sequence<I...>)
+        {
+            (addField<I>(), ...);
+        }
+
+        /// Fields stored in direct child nodes that are decoded one child node at a time.
+        template<size_t I>
+        static constexpr bool isDispatchable()
+        {
+            constexpr auto & field{std::get<I>(fields)};
+            using Member = std::remove_cvref_t<decltype(std::declval<T &>().*field.member)>;
+
+            return field.nodeNames.size() == 1u && !Detail::is_plan_array<Member>::value;
+        }
+
+        template<size_t I>
+        void addField()
+        {
+            if constexpr(isDispatchable<I>())
+            {
+                constexpr auto & field{std::get<I>(fields)};
+                indexed_[I] = index_.try_emplace(field.nodeNames.front(), I).second;
+            }
+        }
+
+        template<typename NodeAdapter, size_t... I>
+        const NodeAdapter &
+          decode(const NodeAdapter & node, T & value, std::index_sequence<I...>) const
+        {
+            // Dispatch table from field index to the decoder of that field
+            using Decoder = void (*)(const NodeAdapter &, T &, bool &);
+            static constexpr std::array<Decoder, fieldCount> decoders{
+              &decodeChild<NodeAdapter, I>...};
+
+            // Child clears sequences even if no child node of their name exists
+            (clearSequence<I>(value), ...);
+
+            std::array<bool, fieldCount> seen{};
+            for(const auto & child : node.getChildNodes())
+            {
+                if(const auto field{fieldIndex(child.getCurrentTag())}; field.has_value())
+                {
+                    decoders[field.value()](child, value, seen[field.value()]);
+                }
+            }
+
+            (decodeRemaining<I>(node, value), ...);
+
+            return node;
+        }
+
+        template<size_t I>
+        void clearSequence(T & value) const
+        {
+            constexpr auto & field{std::get<I>(fields)};
+            auto & member{value.*field.member};
+
+            if constexpr(Detail::is_plan_sequence<std::remove_cvref_t<decltype(member)>>::value)
+            {
+                if(indexed_[I])
+                {
+                    member.clear();
+                }
+            }
+        }
+
+        template<typename NodeAdapter, size_t I>
+        static void decodeChild(const NodeAdapter & child, T & value, bool & seen)
+        {
+            constexpr auto & field{std::get<I>(fields)};
+            auto & member{value.*field.member};
+            using Member = std::remove_cvref_t<decltype(member)>;
+
+            if constexpr(!isDispatchable<I>())
+            {
+                // Never in the index, decoded through Child instead
+                (void)child;
+                (void)member;
+                (void)seen;
+                return;
+            }
+            else if constexpr(Detail::is_plan_sequence<Member>::value)
+            {
+                appendElement(child, member);
+            }
+            else if constexpr(Detail::is_plan_optional_sequence<Member>::value)
+            {
+                if(!seen)
+                {
+                    member.emplace();
+                }
+                appendElement(child, member.value());
+            }
+            else
+            {
+                // Like Child, only the first child node of the name is decoded
+                if(seen)
+                {
+                    return;
+                }
+                DiagnosticsPathScope pathScope{field.nodeNames.front()};
+                child >> member;
+            }
+            seen = true;
+        }
+
+        template<typename NodeAdapter, typename Container>
+        static void appendElement(const NodeAdapter & child, Container & container)
+        {
+            using Element = typename Container::value_type;
+
+            Element item{Detail::makeElement<Element>(container)};
+            child >> item;
+            if constexpr(requires { container.push_back(std::move(item)); })
+            {
+                container.push_back(std::move(item));
+            }
+            else
+            {
+                container.insert(std::move(item));
+            }
+        }
+
+        template<size_t I, typename NodeAdapter>
+        void decodeRemaining(const NodeAdapter & node, T & value) const
+        {
+            if(!indexed_[I])
+            {
+                constexpr auto & field{std::get<I>(fields)};
+                node >> Child{field.nodeNames, value.*field.member};
+            }
+        }
+
+        std::unordered_map<std::string_view, size_t, Detail::TagHash, std::equal_to<>> index_;
+        std::array<bool, fieldCount> indexed_{};
+    };
+
+    /// @tparam T The type of the records.
+    /// @return The decoding plan of the type, built on first use.
+    template<typename T>
+    const RecordPlan<T> & recordPlan()
+    {
+        static const RecordPlan<T> plan;
+        return plan;
+    }
+}   // namespace FileParse
@@ -0,0 +1,155 @@
+#include <algorithm>
+
+#include "Scheduler.hxx"
+
+namespace FileParse
+{
+    namespace
+    {
+        // Identifies the scheduler and worker running on the current thread, if any
+        thread_local const WorkStealingScheduler * currentScheduler{nullptr};
+        thread_local size_t currentWorker{0u};
+
+        std::mutex defaultExecutorMutex;
+        std::shared_ptr<Executor> customDefaultExecutor;
+    }   // namespace
+
+    WorkStealingScheduler::WorkStealingScheduler(size_t workerCount)
+    {
+        if(workerCount == 0u)
+        {
+            workerCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        for(size_t i = 0u; i < workerCount; ++i)
+        {
+            queues_.push_back(std::make_unique<WorkerQueue>());
+        }
+        threads_.reserve(workerCount);
+        for(size_t i = 0u; i < workerCount; ++i)
+        {
+            threads_.emplace_back([this, i]() { run(i); });
+        }
+    }
+
+    WorkStealingScheduler::~WorkStealingScheduler()
+    {
+        {
+            std::scoped_lock lock{wakeMutex_};
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for(auto & thread : threads_)
+        {
+            thread.join();
+        }
+    }
+
+    void WorkStealingScheduler::execute(std::function<void()> task)
+    {
+        const auto queueIndex{currentScheduler == this
+                                ? currentWorker
+                                : nextQueue_.fetch_add(1u, std::memory_order_relaxed)
+                                    % queues_.size()};
+        {
+            auto & queue{*queues_[queueIndex]};
+            std::scoped_lock lock{queue.mutex};
+            queue.tasks.push_back(std::move(task));
+        }
+
+        // The task is counted once it is queued, so a worker claiming it always finds a task
+        {
+            std::scoped_lock lock{wakeMutex_};
+            ++pendingTasks_;
+        }
+        wake_.notify_one();
+    }
+
+    size_t WorkStealingScheduler::concurrency() const
+    {
+        return threads_.size();
+    }
+
+    std::function<void()> WorkStealingScheduler::takeTask(size_t workerIndex)
+    {
+        // Own tasks newest first, they are most likely still in cache
+        {
+            auto & queue{*queues_[workerIndex]};
+            std::scoped_lock lock{queue.mutex};
+            if(!queue.tasks.empty())
+            {
+                auto task{std::move(queue.tasks.back())};
+                queue.tasks.pop_back();
+                return task;
+            }
+        }
+
+        // Steal the oldest task of another worker
+        for(size_t offset = 1u; offset < queues_.size(); ++offset)
+        {
+            auto & queue{*queues_[(workerIndex + offset) % queues_.size()]};
+            std::scoped_lock lock{queue.mutex};
+            if(!queue.tasks.empty())
+            {
+                auto task{std::move(queue.tasks.front())};
+                queue.tasks.pop_front();
+                return task;
+            }
+        }
+
+        return {};
+    }
+
+    void WorkStealingScheduler::run(size_t workerIndex)
+    {
+        currentScheduler = this;
+        currentWorker = workerIndex;
+
+        while(true)
+        {
+            // Claiming a counted task under the lock that counts them keeps idle workers asleep
+            // while the deques are empty
+            {
+                std::unique_lock lock{wakeMutex_};
+                wake_.wait(lock, [this] { return stopping_ || pendingTasks_ > 0u; });
+                if(pendingTasks_ == 0u)
+                {
+                    return;
+                }
+                --pendingTasks_;
+            }
+
+            // The claimed task is queued, but another worker may steal it first from a deque
+            // this one already searched; there is then another task to find
+            auto task{takeTask(workerIndex)};
+            while(!task)
+            {
+                task = takeTask(workerIndex);
+            }
+            try
+            {
+                task();
+            }
+            catch(...)
+            {}
+        }
+    }
+
+    std::shared_ptr<Executor> defaultExecutor()
+    {
+        std::scoped_lock lock{defaultExecutorMutex};
+        if(customDefaultExecutor)
+        {
+            return customDefaultExecutor;
+        }
+
+        static const auto builtInScheduler{std::make_shared<WorkStealingScheduler>()};
+        return builtInScheduler;
+    }
+
+    void setDefaultExecutor(std::shared_ptr<Executor> executor)
+    {
+        std::scoped_lock lock{defaultExecutorMutex};
+        customDefaultExecutor = std::move(executor);
+    }
+}   // namespace FileParse
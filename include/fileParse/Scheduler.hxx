@@ -0,0 +1,81 @@
+/// File: Scheduler.hxx
+/// @brief Provides the executor interface used by all parallel FileParse functions and a
+///        work-stealing thread pool implementing it.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+namespace FileParse
+{
+    /// Runs tasks on some set of threads. Implement this interface to run the parallel FileParse
+    /// functions on an existing thread pool.
+    class Executor
+    {
+    public:
+        virtual ~Executor() = default;
+
+        /// Schedules a task. The task must not throw.
+        /// @param task The task to run.
+        virtual void execute(std::function<void()> task) = 0;
+
+        /// @return The number of tasks the executor runs at the same time.
+        [[nodiscard]] virtual size_t concurrency() const = 0;
+    };
+
+    /// Thread pool where every worker owns a deque of tasks. Workers run their own tasks newest
+    /// first and steal the oldest tasks of other workers once their deque is empty, so nested
+    /// parallel loops keep all workers busy. Remaining tasks are run before destruction.
+    class WorkStealingScheduler : public Executor
+    {
+    public:
+        /// @param workerCount The number of worker threads. Zero selects the hardware
+        /// concurrency.
+        explicit WorkStealingScheduler(size_t workerCount = 0u);
+        ~WorkStealingScheduler() override;
+
+        WorkStealingScheduler(const WorkStealingScheduler &) = delete;
+        WorkStealingScheduler & operator=(const WorkStealingScheduler &) = delete;
+
+        /// Tasks scheduled from a worker go to its own deque, other tasks are distributed over
+        /// the workers in turn.
+        /// @param task The task to run. Exceptions thrown by it are discarded.
+        void execute(std::function<void()> task) override;
+
+        [[nodiscard]] size_t concurrency() const override;
+
+    private:
+        struct WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        [[nodiscard]] std::function<void()> takeTask(size_t workerIndex);
+        void run(size_t workerIndex);
+
+        std::vector<std::unique_ptr<WorkerQueue>> queues_;
+        std::vector<std::thread> threads_;
+        std::mutex wakeMutex_;
+        std::condition_variable wake_;
+        size_t pendingTasks_{0u};
+        std::atomic<size_t> nextQueue_{0u};
+        bool stopping_{false};
+    };
+
+    /// @return The executor used by parallel functions that are not given one explicitly. Unless
+    /// replaced, it is a WorkStealingScheduler with one worker per hardware thread.
+    [[nodiscard]] std::shared_ptr<Executor> defaultExecutor();
+
+    /// Replaces the default executor, e.g. with an adapter to a process-wide thread pool.
+    /// @param executor The new default executor. Null restores the built-in scheduler.
+    void setDefaultExecutor(std::shared_ptr<Executor> executor);
+}   // namespace FileParse
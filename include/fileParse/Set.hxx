@@ -15,11 +15,14 @@ namespace FileParse
     /// Serializes a set as child nodes of a given node.
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam T The type of elements in the set.
+    /// @tparam Compare The comparison type of the set.
+    /// @tparam Allocator The allocator type of the set.
     /// @param node The node to serialize the set into.
     /// @param value The Child object containing the set and node hierarchy information.
     /// @return Reference to the updated node.
-    template<typename NodeAdapter, typename T>
-    inline NodeAdapter & operator<<(NodeAdapter & node, const Child<const std::set<T>> & value)
+    template<typename NodeAdapter, typename T, typename Compare, typename Allocator>
+    inline NodeAdapter & operator<<(NodeAdapter & node,
+                                    const Child<const std::set<T, Compare, Allocator>> & value)
     {
         if(value.nodeNames.empty() || value.data.empty())
             return node;
@@ -38,11 +41,14 @@ namespace FileParse
     /// Deserializes child nodes of a given node into a set.
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam T The type of elements in the set.
+    /// @tparam Compare The comparison type of the set.
+    /// @tparam Allocator The allocator type of the set.
     /// @param node The node to deserialize the set from.
     /// @param vec The Child object where the deserialized set will be stored.
     /// @return Const reference to the node.
-    template<typename NodeAdapter, typename T>
-    inline const NodeAdapter & operator>>(const NodeAdapter & node, const Child<std::set<T>> & vec)
+    template<typename NodeAdapter, typename T, typename Compare, typename Allocator>
+    inline const NodeAdapter & operator>>(const NodeAdapter & node,
+                                          const Child<std::set<T, Compare, Allocator>> & vec)
     {
         vec.data.clear();
 
@@ -54,9 +60,9 @@ namespace FileParse
             const auto childNodes{currentNode.value().getChildNodesByName(vec.nodeNames.back())};
             for(const auto & childNode : childNodes)
             {
-                T item;
+                T item{Detail::makeElement<T>(vec.data)};
                 childNode >> item;
-                vec.data.insert(item);
+                vec.data.insert(std::move(item));
             }
         }
 
@@ -66,12 +72,15 @@ namespace FileParse
     /// Deserializes child nodes into an optional set.
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam T The type of elements in the set.
+    /// @tparam Compare The comparison type of the set.
+    /// @tparam Allocator The allocator type of the set.
     /// @param node The node to deserialize the set from.
     /// @param opt_vec The Child object where the deserialized optional set will be stored.
     /// @return Const reference to the node.
-    template<typename NodeAdapter, typename T>
-    inline const NodeAdapter & operator>>(const NodeAdapter & node,
-                                          const Child<std::optional<std::set<T>>> & opt_vec)
+    template<typename NodeAdapter, typename T, typename Compare, typename Allocator>
+    inline const NodeAdapter &
+      operator>>(const NodeAdapter & node,
+                 const Child<std::optional<std::set<T, Compare, Allocator>>> & opt_vec)
     {
         if(auto childNode{findParentOfLastTag(node, opt_vec.nodeNames)};
            !childNode.has_value() || childNode.value().nChildNode(opt_vec.nodeNames.back()) == 0)
@@ -79,7 +88,7 @@ namespace FileParse
             return node;
         }
 
-        opt_vec.data = std::set<T>();
+        opt_vec.data = std::set<T, Compare, Allocator>();
         node >> Child{opt_vec.nodeNames, opt_vec.data.value()};
 
         return node;
@@ -88,12 +97,15 @@ namespace FileParse
     /// Serializes an optional set as child nodes of a given node.
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam T The type of elements in the set.
+    /// @tparam Compare The comparison type of the set.
+    /// @tparam Allocator The allocator type of the set.
     /// @param node The node to serialize the optional set into.
     /// @param opt_vec The Child object containing the optional set and node hierarchy information.
     /// @return Reference to the updated node.
-    template<typename NodeAdapter, typename T>
-    inline NodeAdapter & operator<<(NodeAdapter & node,
-                                    const Child<const std::optional<std::set<T>>> & opt_vec)
+    template<typename NodeAdapter, typename T, typename Compare, typename Allocator>
+    inline NodeAdapter &
+      operator<<(NodeAdapter & node,
+                 const Child<const std::optional<std::set<T, Compare, Allocator>>> & opt_vec)
     {
         if(opt_vec.data.has_value())
         {
@@ -112,15 +124,17 @@ namespace FileParse
     /// Serializes a set of enum values as child nodes, converting the enums to strings.
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam EnumType The enumeration type of the set's elements.
+    /// @tparam Compare The comparison type of the set.
+    /// @tparam Allocator The allocator type of the set.
     /// @param node The node to serialize the set into.
-    /// @param tags A vector of strings specifying the node hierarchy.
+    /// @param tags The names specifying the node hierarchy.
     /// @param vec The set of enum values to be serialized.
     /// @param converter A function that converts the enum values to strings.
     /// @return Reference to the updated node.
-    template<typename NodeAdapter, typename EnumType>
+    template<typename NodeAdapter, typename EnumType, typename Compare, typename Allocator>
     NodeAdapter & serializeEnumSet(NodeAdapter & node,
-                                   const std::vector<std::string> & tags,
-                                   const std::set<EnumType> & vec,
+                                   const NodePath & tags,
+                                   const std::set<EnumType, Compare, Allocator> & vec,
                                    std::function<std::string(EnumType)> converter)
     {
         if(tags.empty())
@@ -142,15 +156,17 @@ namespace FileParse
     /// Deserializes child nodes into a set of enum values, converting the strings back to enums.
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam EnumType The enumeration type of the set's elements.
+    /// @tparam Compare The comparison type of the set.
+    /// @tparam Allocator The allocator type of the set.
     /// @param node The node to deserialize the set from.
-    /// @param tags A vector of strings specifying the node hierarchy.
+    /// @param tags The names specifying the node hierarchy.
     /// @param vec The set where the deserialized enum values will be stored.
     /// @param converter A function that converts strings to enum values.
     /// @return Const reference to the node.
-    template<typename NodeAdapter, typename EnumType>
+    template<typename NodeAdapter, typename EnumType, typename Compare, typename Allocator>
     const NodeAdapter & deserializeEnumSet(const NodeAdapter & node,
-                                           const std::vector<std::string> & tags,
-                                           std::set<EnumType> & vec,
+                                           const NodePath & tags,
+                                           std::set<EnumType, Compare, Allocator> & vec,
                                            std::function<EnumType(std::string_view)> converter)
     {
         static_assert(std::is_enum_v<EnumType>, "Provided type is not an enum!");
@@ -5,9 +5,14 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <array>
 #include <map>
 #include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <system_error>
+#include <type_traits>
 
 namespace FileParse
 {
@@ -64,6 +69,86 @@ namespace FileParse
         return from_string<T>(str);
     }
 
+    /// Converts the number at the start of a text without throwing. Accepts the same texts as
+    /// std::stoi, std::stoul and std::stod: leading whitespace is skipped, a sign may precede the
+    /// number (a negated unsigned number wraps around like std::stoul), doubles may be written in
+    /// hexadecimal, as inf or nan, and any text after the number is ignored.
+    /// @tparam T The arithmetic type to convert to.
+    /// @param text The text to convert.
+    /// @param value Receives the number; unchanged if the conversion fails.
+    /// @return std::errc{} on success, std::errc::invalid_argument if the text does not start
+    ///         with a number, or std::errc::result_out_of_range if the number does not fit T.
+    template<typename T>
+    std::errc parseNumber(std::string_view text, T & value)
+    {
+        static_assert(std::is_arithmetic_v<T>, "parseNumber converts to arithmetic types only");
+
+        const auto isSign{[](char c) { return c == '+' || c == '-'; }};
+        const auto * first{text.data()};
+        const auto * const last{first + text.size()};
+        while(first != last && std::isspace(static_cast<unsigned char>(*first)))
+        {
+            ++first;
+        }
+
+        bool negative{false};
+        if(first != last && isSign(*first))
+        {
+            negative = *first == '-';
+            ++first;
+            if(first != last && isSign(*first))
+            {
+                return std::errc::invalid_argument;
+            }
+        }
+
+        T magnitude{};
+        std::from_chars_result result{};
+        if constexpr(std::is_floating_point_v<T>)
+        {
+            const auto isHexDigit{[last](const char * position) {
+                return position < last && std::isxdigit(static_cast<unsigned char>(*position));
+            }};
+            if(last - first > 1 && first[0] == '0' && (first[1] == 'x' || first[1] == 'X'))
+            {
+                // std::from_chars takes hexadecimal digits without the prefix; "0x" without
+                // digits is the number 0 followed by the text "x..." as for std::stod
+                const auto * const digits{first + 2};
+                const bool hasDigits{isHexDigit(digits)
+                                     || (digits < last && *digits == '.' && isHexDigit(digits + 1))};
+                result = hasDigits
+                           ? std::from_chars(digits, last, magnitude, std::chars_format::hex)
+                           : std::from_chars(first, first + 1, magnitude);
+            }
+            else
+            {
+                result = std::from_chars(first, last, magnitude);
+            }
+            if(result.ec == std::errc{})
+            {
+                value = negative ? -magnitude : magnitude;
+            }
+        }
+        else if constexpr(std::is_signed_v<T>)
+        {
+            // The sign is handed to std::from_chars so that the smallest value is accepted
+            result = std::from_chars(negative ? first - 1 : first, last, magnitude);
+            if(result.ec == std::errc{})
+            {
+                value = magnitude;
+            }
+        }
+        else
+        {
+            result = std::from_chars(first, last, magnitude);
+            if(result.ec == std::errc{})
+            {
+                value = negative ? static_cast<T>(T{0} - magnitude) : magnitude;
+            }
+        }
+        return result.ec;
+    }
+
     /// Enumerator to string conversion routines.
 
     /// /// Converts an enumerator value to a string.
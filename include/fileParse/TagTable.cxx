@@ -0,0 +1,83 @@
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "TagTable.hxx"
+
+namespace FileParse
+{
+    namespace
+    {
+        struct TagTable
+        {
+            std::shared_mutex mutex;
+            // A deque never moves its elements, so the interned strings keep their addresses
+            std::deque<std::string> names;
+            std::unordered_map<std::string_view, const std::string *> index;
+        };
+
+        TagTable & tagTable()
+        {
+            static TagTable table;
+            return table;
+        }
+
+        const std::string emptyName;
+
+        const std::string * intern(std::string_view name)
+        {
+            if(name.empty())
+            {
+                return &emptyName;
+            }
+
+            // Keys of the cache view the interned strings, so they stay valid
+            thread_local std::unordered_map<std::string_view, const std::string *> cache;
+            if(const auto it{cache.find(name)}; it != cache.end())
+            {
+                return it->second;
+            }
+
+            auto & table{tagTable()};
+            const std::string * text{nullptr};
+            {
+                std::shared_lock lock{table.mutex};
+                if(const auto it{table.index.find(name)}; it != table.index.end())
+                {
+                    text = it->second;
+                }
+            }
+
+            if(text == nullptr)
+            {
+                std::unique_lock lock{table.mutex};
+                if(const auto it{table.index.find(name)}; it != table.index.end())
+                {
+                    text = it->second;
+                }
+                else
+                {
+                    text = &table.names.emplace_back(name);
+                    table.index.emplace(*text, text);
+                }
+            }
+
+            cache.emplace(*text, text);
+            return text;
+        }
+    }   // namespace
+
+    Tag::Tag() noexcept : text_(&emptyName)
+    {}
+
+    Tag::Tag(std::string_view name) : text_(intern(name))
+    {}
+
+    size_t internedTagCount()
+    {
+        auto & table{tagTable()};
+        std::shared_lock lock{table.mutex};
+        return table.names.size();
+    }
+}   // namespace FileParse
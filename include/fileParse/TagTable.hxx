@@ -0,0 +1,53 @@
+/// File: TagTable.hxx
+/// @brief Provides interning of tag names, so that names repeated throughout documents are stored
+///        once and compared by identity instead of by their text.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace FileParse
+{
+    /// A tag name stored once in a process-wide table. Copies are the size of a pointer and
+    /// tags compare by identity. Interned text lives until the program ends, so only node names
+    /// should be interned, never node content.
+    class Tag
+    {
+    public:
+        /// The empty tag.
+        Tag() noexcept;
+
+        /// Interns a name. Names already interned by the calling thread are found without
+        /// locking.
+        /// @param name The tag name.
+        explicit Tag(std::string_view name);
+
+        [[nodiscard]] std::string_view view() const noexcept
+        {
+            return *text_;
+        }
+
+        [[nodiscard]] const std::string & str() const noexcept
+        {
+            return *text_;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return text_->empty();
+        }
+
+        friend bool operator==(const Tag & lhs, const Tag & rhs) noexcept
+        {
+            return lhs.text_ == rhs.text_;
+        }
+
+    private:
+        const std::string * text_;
+    };
+
+    /// @return The number of distinct non-empty names interned so far.
+    [[nodiscard]] size_t internedTagCount();
+}   // namespace FileParse
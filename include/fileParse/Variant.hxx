@@ -14,11 +14,11 @@ namespace FileParse
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam Ts Variadic template representing the types held by the variant.
     /// @param node The node to serialize the variant into.
-    /// @param nodeNames A vector of strings representing the names for each type in the variant.
+    /// @param nodeNames The names for each type in the variant.
     /// @param variantValue The std::variant value to be serialized.
     template<typename NodeAdapter, typename... Ts>
     void serializeVariant(NodeAdapter & node,
-                          const std::vector<std::string> & nodeNames,
+                          const NodePath & nodeNames,
                           const std::variant<Ts...> & variantValue)
     {
         if(variantValue.index() < nodeNames.size())
@@ -35,11 +35,11 @@ namespace FileParse
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam Ts Variadic template representing the types held by the variant.
     /// @param node The node to deserialize the variant from.
-    /// @param nodeNames A vector of strings representing the names for each type in the variant.
+    /// @param nodeNames The names for each type in the variant.
     /// @param variantValue The std::variant value to store the deserialized data.
     template<typename NodeAdapter, typename... Ts>
     void deserializeVariant(const NodeAdapter & node,
-                            const std::vector<std::string> & nodeNames,
+                            const NodePath & nodeNames,
                             std::variant<Ts...> & variantValue)
     {
         bool deserialized = false;
@@ -67,11 +67,11 @@ namespace FileParse
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam Ts Variadic template representing the types held by the variant.
     /// @param node The node to serialize the optional variant into.
-    /// @param nodeNames A vector of strings representing the names for each type in the variant.
+    /// @param nodeNames The names for each type in the variant.
     /// @param optionalVariantValue The std::optional<std::variant> value to be serialized.
     template<typename NodeAdapter, typename... Ts>
     void serializeOptionalVariant(NodeAdapter & node,
-                                  const std::vector<std::string> & nodeNames,
+                                  const NodePath & nodeNames,
                                   const std::optional<std::variant<Ts...>> & optionalVariantValue)
     {
         if(optionalVariantValue.has_value())
@@ -85,12 +85,12 @@ namespace FileParse
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam Ts Variadic template representing the types held by the variant.
     /// @param node The node to deserialize the optional variant from.
-    /// @param nodeNames A vector of strings representing the names for each type in the variant.
+    /// @param nodeNames The names for each type in the variant.
     /// @param optionalVariantValue The std::optional<std::variant> value to store the deserialized
     /// data.
     template<typename NodeAdapter, typename... Ts>
     void deserializeOptionalVariant(const NodeAdapter & node,
-                                    const std::vector<std::string> & nodeNames,
+                                    const NodePath & nodeNames,
                                     std::optional<std::variant<Ts...>> & optionalVariantValue)
     {
         std::variant<Ts...> variantValue;
@@ -141,11 +141,11 @@ namespace FileParse
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam Ts Variadic template representing the vector types held by the variant.
     /// @param node The node to serialize the variant into.
-    /// @param nodeNames A vector of strings representing the names for each type in the variant.
+    /// @param nodeNames The names for each type in the variant.
     /// @param variantValue The std::variant value containing vectors to be serialized.
     template<typename NodeAdapter, typename... Ts>
     void serializeVariantVector(NodeAdapter & node,
-                                const std::vector<std::string> & nodeNames,
+                                const NodePath & nodeNames,
                                 const std::variant<Ts...> & variantValue)
     {
         if(variantValue.index() < nodeNames.size())
@@ -167,11 +167,11 @@ namespace FileParse
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam Ts Variadic template representing the vector types held by the variant.
     /// @param node The node to deserialize the variant from.
-    /// @param nodeNames A vector of strings representing the names for each type in the variant.
+    /// @param nodeNames The names for each type in the variant.
     /// @param variantValue The std::variant value to store the deserialized vectors.
     template<typename NodeAdapter, typename... Ts>
     void deserializeVariantVector(const NodeAdapter & node,
-                                  const std::vector<std::string> & nodeNames,
+                                  const NodePath & nodeNames,
                                   std::variant<Ts...> & variantValue)
     {
         bool deserialized = false;
@@ -203,11 +203,11 @@ namespace FileParse
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam Ts Variadic template representing the vector types held by the variant.
     /// @param node The node to serialize the optional variant into.
-    /// @param nodeNames A vector of strings representing the names for each type in the variant.
+    /// @param nodeNames The names for each type in the variant.
     /// @param optionalVariantValue The std::optional<std::variant> value containing vectors to be serialized.
     template<typename NodeAdapter, typename... Ts>
     void serializeOptionalVariantVector(NodeAdapter & node,
-                                        const std::vector<std::string> & nodeNames,
+                                        const NodePath & nodeNames,
                                         const std::optional<std::variant<Ts...>> & optionalVariantValue)
     {
         if(optionalVariantValue.has_value())
@@ -220,11 +220,11 @@ namespace FileParse
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam Ts Variadic template representing the vector types held by the variant.
     /// @param node The node to deserialize the optional variant from.
-    /// @param nodeNames A vector of strings representing the names for each type in the variant.
+    /// @param nodeNames The names for each type in the variant.
     /// @param optionalVariantValue The std::optional<std::variant> value to store the deserialized vectors.
     template<typename NodeAdapter, typename... Ts>
     void deserializeOptionalVariantVector(const NodeAdapter & node,
-                                          const std::vector<std::string> & nodeNames,
+                                          const NodePath & nodeNames,
                                           std::optional<std::variant<Ts...>> & optionalVariantValue)
     {
         std::variant<Ts...> variantValue;
@@ -10,17 +10,21 @@
 #include <stdexcept>
 
 #include "Common.hxx"
+#include "Packed.hxx"
+#include "Parallel.hxx"
 
 namespace FileParse
 {
     /// Serializes a vector as child nodes of a given node.
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam T The type of elements in the vector.
+    /// @tparam Allocator The allocator type of the vector.
     /// @param node The node to serialize the vector into.
     /// @param vec The Child object containing the vector and node hierarchy information.
     /// @return Reference to the updated node.
-    template<typename NodeAdapter, typename T>
-    inline NodeAdapter & operator<<(NodeAdapter & node, const Child<const std::vector<T>> & vec)
+    template<typename NodeAdapter, typename T, typename Allocator>
+    inline NodeAdapter & operator<<(NodeAdapter & node,
+                                    const Child<const std::vector<T, Allocator>> & vec)
     {
         if(vec.nodeNames.empty() || vec.data.empty())
             return node;
@@ -29,10 +33,17 @@ namespace FileParse
 
         const auto & lastNodeName = vec.nodeNames.back();
 
-        for(const auto & item : vec.data)
+        if constexpr(std::is_same_v<T, double>)
+        {
+            addDoubleChildNodes(secondToLastNode, lastNodeName, vec.data);
+        }
+        else
         {
-            NodeAdapter lastNode = secondToLastNode.addChild(lastNodeName);
-            lastNode << item;
+            for(const auto & item : vec.data)
+            {
+                NodeAdapter lastNode = secondToLastNode.addChild(lastNodeName);
+                lastNode << item;
+            }
         }
 
         return node;
@@ -41,12 +52,13 @@ namespace FileParse
     /// Deserializes child nodes of a given node into a vector.
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam T The type of elements in the vector.
+    /// @tparam Allocator The allocator type of the vector.
     /// @param node The node to deserialize the vector from.
     /// @param vec The Child object where the deserialized vector will be stored.
     /// @return Const reference to the node.
-    template<typename NodeAdapter, typename T>
+    template<typename NodeAdapter, typename T, typename Allocator>
     inline const NodeAdapter & operator>>(const NodeAdapter & node,
-                                          const Child<std::vector<T>> & vec)
+                                          const Child<std::vector<T, Allocator>> & vec)
     {
         vec.data.clear();
 
@@ -55,13 +67,13 @@ namespace FileParse
 
         if(auto currentNode{findParentOfLastTag(node, vec.nodeNames)}; currentNode.has_value())
         {
+            vec.data.reserve(currentNode.value().countChildren(vec.nodeNames.back()));
             const auto childNodes{currentNode.value().getChildNodesByName(vec.nodeNames.back())};
-            vec.data.reserve(childNodes.size());
             for(const auto & childNode : childNodes)
             {
-                T item;
+                T item{Detail::makeElement<T>(vec.data)};
                 childNode >> item;
-                vec.data.push_back(item);
+                vec.data.push_back(std::move(item));
             }
         }
 
@@ -71,12 +83,14 @@ namespace FileParse
     /// Deserializes child nodes into an optional vector.
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam T The type of elements in the vector.
+    /// @tparam Allocator The allocator type of the vector.
     /// @param node The node to deserialize the optional vector from.
     /// @param opt_vec The Child object where the deserialized optional vector will be stored.
     /// @return Const reference to the node.
-    template<typename NodeAdapter, typename T>
-    inline const NodeAdapter & operator>>(const NodeAdapter & node,
-                                          const Child<std::optional<std::vector<T>>> & opt_vec)
+    template<typename NodeAdapter, typename T, typename Allocator>
+    inline const NodeAdapter &
+      operator>>(const NodeAdapter & node,
+                 const Child<std::optional<std::vector<T, Allocator>>> & opt_vec)
     {
         if(auto childNode{findParentOfLastTag(node, opt_vec.nodeNames)};
            !childNode.has_value() || childNode.value().nChildNode(opt_vec.nodeNames.back()) == 0)
@@ -84,7 +98,7 @@ namespace FileParse
             return node;
         }
 
-        opt_vec.data = std::vector<T>();
+        opt_vec.data = std::vector<T, Allocator>();
         node >> Child{opt_vec.nodeNames, opt_vec.data.value()};
 
         return node;
@@ -93,23 +107,185 @@ namespace FileParse
     /// Serializes an optional vector as child nodes of a given node.
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam T The type of elements in the vector.
+    /// @tparam Allocator The allocator type of the vector.
     /// @param node The node to serialize the optional vector into.
     /// @param opt_vec The Child object containing the optional vector and node hierarchy
     /// information.
     /// @return Reference to the updated node.
-    template<typename NodeAdapter, typename T>
-    inline NodeAdapter & operator<<(NodeAdapter & node,
-                                    const Child<const std::optional<std::vector<T>>> & opt_vec)
+    template<typename NodeAdapter, typename T, typename Allocator>
+    inline NodeAdapter &
+      operator<<(NodeAdapter & node,
+                 const Child<const std::optional<std::vector<T, Allocator>>> & opt_vec)
     {
         if(opt_vec.data.has_value())
         {
             auto currentNode{insertAllButLastChild(node, opt_vec.nodeNames)};
 
-            for(const auto & item : opt_vec.data.value())
+            if constexpr(std::is_same_v<T, double>)
+            {
+                addDoubleChildNodes(currentNode, opt_vec.nodeNames.back(), opt_vec.data.value());
+            }
+            else
+            {
+                for(const auto & item : opt_vec.data.value())
+                {
+                    auto tableNode = currentNode.addChild(opt_vec.nodeNames.back());
+                    tableNode << item;
+                }
+            }
+        }
+
+        return node;
+    }
+
+    /// Serializes a vector of numbers packed into a single node.
+    /// @tparam NodeAdapter The type of the node adapter.
+    /// @tparam T The arithmetic type of elements in the vector.
+    /// @tparam Allocator The allocator type of the vector.
+    /// @param node The node to serialize the vector into.
+    /// @param vec The Packed object containing the vector and node hierarchy information.
+    /// @return Reference to the updated node.
+    template<typename NodeAdapter, typename T, typename Allocator>
+    inline NodeAdapter & operator<<(NodeAdapter & node,
+                                    const Packed<const std::vector<T, Allocator>> & vec)
+    {
+        return serializePacked(node, vec.nodeNames, std::span<const T>{vec.data});
+    }
+
+    /// Serializes a vector of numbers packed into a single node.
+    /// @tparam NodeAdapter The type of the node adapter.
+    /// @tparam T The arithmetic type of elements in the vector.
+    /// @tparam Allocator The allocator type of the vector.
+    /// @param node The node to serialize the vector into.
+    /// @param vec The Packed object containing the vector and node hierarchy information.
+    /// @return Reference to the updated node.
+    template<typename NodeAdapter, typename T, typename Allocator>
+    inline NodeAdapter & operator<<(NodeAdapter & node,
+                                    const Packed<std::vector<T, Allocator>> & vec)
+    {
+        return serializePacked(node, vec.nodeNames, std::span<const T>{vec.data});
+    }
+
+    /// Deserializes numbers packed into a single node into a vector.
+    /// @tparam NodeAdapter The type of the node adapter.
+    /// @tparam T The arithmetic type of elements in the vector.
+    /// @tparam Allocator The allocator type of the vector.
+    /// @param node The node to deserialize the vector from.
+    /// @param vec The Packed object where the deserialized vector will be stored. Left empty if
+    /// the text is malformed and reported to the active DiagnosticsSink.
+    /// @return Const reference to the node.
+    template<typename NodeAdapter, typename T, typename Allocator>
+    inline const NodeAdapter & operator>>(const NodeAdapter & node,
+                                          const Packed<std::vector<T, Allocator>> & vec)
+    {
+        vec.data.clear();
+
+        if(const auto text{findPackedValues(node, vec.nodeNames)}; text.has_value())
+        {
+            DiagnosticsPathScope pathScope{vec.nodeNames.back()};
+            auto values{parsePackedValuesOrReport<T>(text.value())};
+            if(!values.has_value())
+            {
+                return node;
+            }
+            if constexpr(std::is_same_v<Allocator, std::allocator<T>>)
+            {
+                vec.data = std::move(values.value());
+            }
+            else
+            {
+                vec.data.assign(values->begin(), values->end());
+            }
+        }
+
+        return node;
+    }
+
+    /// Serializes a vector as child nodes of a given node on multiple threads. Every element is
+    /// written into its own detached node by a worker thread and the finished subtrees are then
+    /// appended on the calling thread in the order of the vector, so the output is identical to
+    /// the one produced by Child. Adapters without support for detached nodes are serialized on
+    /// the calling thread instead.
+    /// @tparam NodeAdapter The type of the node adapter.
+    /// @tparam T The type of elements in the vector.
+    /// @tparam Allocator The allocator type of the vector.
+    /// @param node The node to serialize the vector into.
+    /// @param vec The ParallelChild object containing the vector and node hierarchy information.
+    /// @return Reference to the updated node.
+    /// @throws The first exception thrown while encoding an element. Nothing is appended then.
+    template<typename NodeAdapter, typename T, typename Allocator>
+    inline NodeAdapter & operator<<(NodeAdapter & node,
+                                    const ParallelChild<const std::vector<T, Allocator>> & vec)
+    {
+        if(vec.nodeNames.empty() || vec.data.empty())
+            return node;
+
+        auto secondToLastNode{insertAllButLastChild(node, vec.nodeNames)};
+
+        const auto & lastNodeName = vec.nodeNames.back();
+
+        if(!secondToLastNode.supportsDetachedNodes())
+        {
+            for(const auto & item : vec.data)
+            {
+                NodeAdapter lastNode = secondToLastNode.addChild(lastNodeName);
+                lastNode << item;
+            }
+            return node;
+        }
+
+        std::vector<std::optional<NodeAdapter>> subtrees(vec.data.size());
+        parallelForChunks(vec.data.size(), vec.threadCount, [&](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i)
             {
-                auto tableNode = currentNode.addChild(opt_vec.nodeNames.back());
-                tableNode << item;
+                NodeAdapter subtree{secondToLastNode.createDetachedNode(lastNodeName)};
+                subtree << vec.data[i];
+                subtrees[i].emplace(std::move(subtree));
             }
+        });
+
+        for(auto & subtree : subtrees)
+        {
+            secondToLastNode.appendChild(subtree.value());
+        }
+
+        return node;
+    }
+
+    /// Deserializes child nodes of a given node into a vector on multiple threads. The child
+    /// nodes are partitioned into contiguous ranges and every element is decoded directly into
+    /// its slot of the pre-sized vector, so the order of the child nodes is preserved.
+    /// @tparam NodeAdapter The type of the node adapter. Its const methods must be safe to call
+    /// from multiple threads.
+    /// @tparam T The default constructible type of elements in the vector.
+    /// @tparam Allocator The allocator type of the vector.
+    /// @param node The node to deserialize the vector from.
+    /// @param vec The ParallelChild object where the deserialized vector will be stored.
+    /// @return Const reference to the node.
+    /// @throws The first exception thrown while decoding an element.
+    template<typename NodeAdapter, typename T, typename Allocator>
+    inline const NodeAdapter & operator>>(const NodeAdapter & node,
+                                          const ParallelChild<std::vector<T, Allocator>> & vec)
+    {
+        static_assert(!std::is_same_v<T, bool>,
+                      "std::vector<bool> elements cannot be written from multiple threads!");
+
+        vec.data.clear();
+
+        if(vec.nodeNames.empty() || !node.hasChildNode(vec.nodeNames.front()))
+            return node;
+
+        if(auto currentNode{findParentOfLastTag(node, vec.nodeNames)}; currentNode.has_value())
+        {
+            const auto childNodes{currentNode.value().getChildNodesByName(vec.nodeNames.back())};
+            vec.data.resize(childNodes.size());
+
+            parallelForChunks(childNodes.size(), vec.threadCount, [&](size_t begin, size_t end) {
+                for(size_t i = begin; i < end; ++i)
+                {
+                    childNodes[i] >> vec.data[i];
+                }
+            });
         }
 
         return node;
@@ -118,15 +294,16 @@ namespace FileParse
     /// Serializes a vector of enum values as child nodes, converting the enums to strings.
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam EnumType The enumeration type of the vector's elements.
+    /// @tparam Allocator The allocator type of the vector.
     /// @param node The node to serialize the vector into.
-    /// @param tags A vector of strings specifying the node hierarchy.
+    /// @param tags The names specifying the node hierarchy.
     /// @param vec The vector of enum values to be serialized.
     /// @param converter A function that converts the enum values to strings.
     /// @return Reference to the updated node.
-    template<typename NodeAdapter, typename EnumType>
+    template<typename NodeAdapter, typename EnumType, typename Allocator>
     NodeAdapter & serializeEnumVector(NodeAdapter & node,
-                                      const std::vector<std::string> & tags,
-                                      const std::vector<EnumType> & vec,
+                                      const NodePath & tags,
+                                      const std::vector<EnumType, Allocator> & vec,
                                       std::function<std::string(EnumType)> converter)
     {
         if(tags.empty())
@@ -148,15 +325,16 @@ namespace FileParse
     /// Deserializes child nodes into a vector of enum values, converting the strings back to enums.
     /// @tparam NodeAdapter The type of the node adapter.
     /// @tparam EnumType The enumeration type of the vector's elements.
+    /// @tparam Allocator The allocator type of the vector.
     /// @param node The node to deserialize the vector from.
-    /// @param tags A vector of strings specifying the node hierarchy.
+    /// @param tags The names specifying the node hierarchy.
     /// @param vec The vector where the deserialized enum values will be stored.
     /// @param converter A function that converts strings to enum values.
     /// @return Const reference to the node.
-    template<typename NodeAdapter, typename EnumType>
+    template<typename NodeAdapter, typename EnumType, typename Allocator>
     const NodeAdapter & deserializeEnumVector(const NodeAdapter & node,
-                                              const std::vector<std::string> & tags,
-                                              std::vector<EnumType> & vec,
+                                              const NodePath & tags,
+                                              std::vector<EnumType, Allocator> & vec,
                                               std::function<EnumType(std::string_view)> converter)
     {
         static_assert(std::is_enum_v<EnumType>, "Provided type is not an enum!");
@@ -170,8 +348,8 @@ namespace FileParse
 
         if(auto currentNode{findParentOfLastTag(node, tags)}; currentNode.has_value())
         {
+            vec.reserve(currentNode.value().countChildren(tags.back()));
             const auto childNodes{currentNode.value().getChildNodesByName(tags.back())};
-            vec.reserve(childNodes.size());
             for(const auto & childNode : childNodes)
             {
                 const auto text = childNode.getText();
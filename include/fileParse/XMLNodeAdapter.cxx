@@ -1,44 +1,95 @@
 #include <algorithm>
 #include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "XMLNodeAdapter.hxx"
+#include "FileWriter.hxx"
 
 #include "xmlParser/xmlParser.h"
 
-struct XMLNodeAdapter::Impl
+// XMLNode handles share a reference count that is not atomic. Adapters therefore never copy
+// handles on the read path. Every node of a document is copied exactly once into a tree of Nodes
+// owned by the document, and adapters only point into that tree. The handles of the children of
+// a node are copied the first time they are needed, guarded by the once_flag of that node, so
+// threads reading the same document never change a reference count at the same time.
+struct XMLNodeAdapter::Node
 {
-    explicit Impl(XMLParser::XMLNode xmlNode) : node_(xmlNode)
+    explicit Node(XMLParser::XMLNode xmlNode) : handle(xmlNode)
     {}
-    XMLParser::XMLNode node_;
+
+    Node(const Node &) = delete;
+    Node & operator=(const Node &) = delete;
+
+    const std::vector<std::unique_ptr<Node>> & childNodes()
+    {
+        std::call_once(childrenLoaded, [this]() {
+            const auto count{handle.nChildNode()};
+            children.reserve(static_cast<size_t>(std::max(count, 0)));
+            for(int i = 0; i < count; ++i)
+            {
+                children.push_back(std::make_unique<Node>(handle.getChildNode(i)));
+            }
+        });
+        return children;
+    }
+
+    // Only called while the document is modified, which excludes concurrent reads. The existing
+    // children are loaded before the new one is added to the XMLNode, so it is not loaded twice.
+    template<typename Child>
+    Node & add(const Child & child)
+    {
+        childNodes();
+        return *children.emplace_back(std::make_unique<Node>(handle.addChild(child)));
+    }
+
+    XMLParser::XMLNode handle;
+    std::once_flag childrenLoaded;
+    std::vector<std::unique_ptr<Node>> children;
+};
+
+struct XMLNodeAdapter::Document
+{
+    explicit Document(XMLParser::XMLNode xmlNode) : root(std::make_unique<Node>(xmlNode))
+    {}
+
+    std::unique_ptr<Node> root;
 };
 
-XMLNodeAdapter::XMLNodeAdapter(XMLParser::XMLNode xmlNode) : pimpl_(std::make_shared<Impl>(xmlNode))
+XMLNodeAdapter::XMLNodeAdapter(XMLParser::XMLNode xmlNode) :
+    document_(std::make_shared<Document>(xmlNode)), node_(document_->root.get())
+{}
+
+XMLNodeAdapter::XMLNodeAdapter(std::shared_ptr<Document> document, Node & node) :
+    document_(std::move(document)), node_(&node)
 {}
 
 bool XMLNodeAdapter::isEmpty() const
 {
-    return pimpl_->node_.isEmpty();
+    return node_->handle.isEmpty();
 }
 
 std::string XMLNodeAdapter::getText() const
 {
     // getText will return nullptr if the text is empty string. This will cause a crash in the
     // calling code. So, we need to check for nullptr and return empty string in that case.
-    if(pimpl_->node_.getText())
+    if(node_->handle.getText())
     {
-        return pimpl_->node_.getText();
+        return node_->handle.getText();
     }
     return {};
 }
 
 std::vector<XMLNodeAdapter> XMLNodeAdapter::getChildNodes() const
 {
-    std::vector<XMLNodeAdapter> children;
-    children.reserve(pimpl_->node_.nChildNode());
+    const auto & childNodes{node_->childNodes()};
 
-    for(int i = 0; i < pimpl_->node_.nChildNode(); ++i)
+    std::vector<XMLNodeAdapter> children;
+    children.reserve(childNodes.size());
+    for(const auto & child : childNodes)
     {
-        children.emplace_back(pimpl_->node_.getChildNode(i));
+        children.push_back(XMLNodeAdapter(document_, *child));
     }
 
     return children;
@@ -46,11 +97,11 @@ std::vector<XMLNodeAdapter> XMLNodeAdapter::getChildNodes() const
 
 std::optional<XMLNodeAdapter> XMLNodeAdapter::getFirstChildByName(std::string_view name) const
 {
-    for(int i = 0; i < pimpl_->node_.nChildNode(); ++i)
+    for(const auto & child : node_->childNodes())
     {
-        if(auto childNode{pimpl_->node_.getChildNode(i)}; childNode.getName() == name)
+        if(child->handle.getName() == name)
         {
-            return XMLNodeAdapter(childNode);
+            return XMLNodeAdapter(document_, *child);
         }
     }
     return std::nullopt;
@@ -59,65 +110,85 @@ std::optional<XMLNodeAdapter> XMLNodeAdapter::getFirstChildByName(std::string_vi
 std::vector<XMLNodeAdapter> XMLNodeAdapter::getChildNodesByName(std::string_view name) const
 {
     std::vector<XMLNodeAdapter> filteredChildren;
-    filteredChildren.reserve(pimpl_->node_.nChildNode());
+    filteredChildren.reserve(nChildNode(name));
 
-    for(int i = 0; i < pimpl_->node_.nChildNode(); ++i)
+    for(const auto & child : node_->childNodes())
     {
-        auto childNode = pimpl_->node_.getChildNode(i);
-        if(childNode.getName() == name)
+        if(child->handle.getName() == name)
         {
-            filteredChildren.emplace_back(childNode);
+            filteredChildren.push_back(XMLNodeAdapter(document_, *child));
         }
     }
 
-    filteredChildren.shrink_to_fit();
-
     return filteredChildren;
 }
 
 int XMLNodeAdapter::nChildNode(std::string_view name) const
 {
-    return pimpl_->node_.nChildNode(name.data());
+    return node_->handle.nChildNode(name.data());
 }
 
 XMLNodeAdapter XMLNodeAdapter::addChild(std::string_view name)
 {
-    return XMLNodeAdapter(pimpl_->node_.addChild(name.data()));
+    return XMLNodeAdapter(document_, node_->add(name.data()));
+}
+
+bool XMLNodeAdapter::supportsDetachedNodes() const
+{
+    return true;
+}
+
+XMLNodeAdapter XMLNodeAdapter::createDetachedNode(std::string_view name) const
+{
+    return createXMLTopNode(name);
+}
+
+void XMLNodeAdapter::appendChild(XMLNodeAdapter & child)
+{
+    node_->add(child.node_->handle);
+
+    // The moved subtree belongs to this document now. The handles the detached document still
+    // holds are released here, on the thread that modifies this document.
+    if(child.document_ != document_)
+    {
+        child.document_->root.reset();
+    }
 }
 
 void XMLNodeAdapter::addText(std::string_view text)
 {
-    pimpl_->node_.addText(text.data());
+    node_->handle.addText(text.data());
 }
 
 int XMLNodeAdapter::writeToFile(std::string_view outString) const
 {
-    return pimpl_->node_.writeToFile(outString.data());
+    // Written through the same atomic writer as the JSON files instead of the XML library
+    return FileParse::writeFileAtomically(outString, getContent()) ? 0 : 1;
 }
 
 bool XMLNodeAdapter::hasChildNode(std::string_view name) const
 {
-    return pimpl_->node_.nChildNode(name.data()) > 0;
+    return node_->handle.nChildNode(name.data()) > 0;
 }
 
 std::string XMLNodeAdapter::getCurrentTag() const
 {
-    return pimpl_->node_.getName();
+    return node_->handle.getName();
 }
 
 std::string XMLNodeAdapter::getContent() const
 {
-    return pimpl_->node_.createXMLString();
+    return node_->handle.createXMLString();
 }
 
 void XMLNodeAdapter::addAttribute(std::string_view name, std::string_view value)
 {
-    pimpl_->node_.addAttribute(name.data(), value.data());
+    node_->handle.addAttribute(name.data(), value.data());
 }
 
 std::optional<std::string> XMLNodeAdapter::getAttribute(std::string_view name) const
 {
-    if(const char * attribute{pimpl_->node_.getAttribute(name.data())}; attribute != nullptr)
+    if(const char * attribute{node_->handle.getAttribute(name.data())}; attribute != nullptr)
     {
         return std::string(attribute);
     }
@@ -157,3 +228,29 @@ std::optional<XMLNodeAdapter> getXMLTopNodeFromString(std::string_view xml,
     }
     return std::nullopt;
 }
+
+FileParse::Expected<XMLNodeAdapter> tryGetXMLTopNodeFromString(std::string_view xml,
+                                                              std::string_view topNodeName)
+{
+    XMLParser::XMLResults results{};
+    auto node{XMLParser::XMLNode::parseString(xml.data(), topNodeName.data(), &results)};
+    if(results.error == XMLParser::eXMLErrorNone && !node.isEmpty())
+    {
+        return XMLNodeAdapter(node);
+    }
+
+    FileParse::LoadError error;
+    error.message = XMLParser::XMLNode::getError(results.error);
+    if(results.error == XMLParser::eXMLErrorNone
+       || results.error == XMLParser::eXMLErrorFirstTagNotFound)
+    {
+        error.category = FileParse::ErrorCategory::MissingNode;
+        error.nodePath = topNodeName;
+        return error;
+    }
+
+    error.line = static_cast<size_t>(std::max(results.nLine, 1));
+    error.column = static_cast<size_t>(std::max(results.nColumn, 1));
+    FileParse::setOffset(error, xml);
+    return error;
+}
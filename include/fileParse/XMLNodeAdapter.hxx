@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "Expected.hxx"
 #include "INodeAdapter.hxx"
 
 namespace XMLParser
@@ -15,6 +16,8 @@ namespace XMLParser
 
 /// Class XMLNodeAdapter
 /// Adapts XMLNode for use with FileParse functionalities.
+/// Const member functions may be called concurrently from multiple threads on adapters of the
+/// same document. Modifying a document while it is read from other threads is not supported.
 class XMLNodeAdapter : public INodeAdapter<XMLNodeAdapter>
 {
 public:
@@ -65,13 +68,27 @@ public:
     /// @return The newly added child node adapter.
     [[nodiscard]] XMLNodeAdapter addChild(std::string_view name) override;
 
+    /// Checks if the adapter supports createDetachedNode and appendChild.
+    /// @return Always true.
+    [[nodiscard]] bool supportsDetachedNodes() const override;
+
+    /// Creates a new top node that is not part of this document.
+    /// @param name The name of the new node.
+    /// @return The detached node adapter.
+    [[nodiscard]] XMLNodeAdapter createDetachedNode(std::string_view name) const override;
+
+    /// Moves a detached node and its subtree to the end of the child nodes.
+    /// @param child The node created by createDetachedNode.
+    void appendChild(XMLNodeAdapter & child) override;
+
     /// Adds text content to the node.
     /// @param text The text to add to the node.
     void addText(std::string_view text) override;
 
-    /// Writes the node's content to a file.
+    /// Writes the node's content to a file. The file is replaced atomically, so it is never
+    /// left with partial content.
     /// @param outString The name of the file to write the content to.
-    /// @return The number of characters written.
+    /// @return 0 on success, non-zero on failure.
     [[nodiscard]] int writeToFile(std::string_view outString) const;
 
     [[nodiscard]] std::string getContent() const override;
@@ -80,8 +97,14 @@ public:
     [[nodiscard]] std::optional<std::string> getAttribute(std::string_view name) const override;
 
 private:
-    struct Impl;
-    std::shared_ptr<Impl> pimpl_;   ///< Pointer to the implementation details.
+    struct Node;
+    struct Document;
+
+    /// Wraps a node of the given document.
+    XMLNodeAdapter(std::shared_ptr<Document> document, Node & node);
+
+    std::shared_ptr<Document> document_;   ///< Keeps the nodes of the document alive.
+    Node * node_;                          ///< The adapted node, owned by the document.
 };
 
 /// Creates a top-level XML node with a specified name.
@@ -101,4 +124,11 @@ private:
 /// @param topNodeName The name of the top node to retrieve.
 /// @return An optional containing the top node adapter if successful, std::nullopt otherwise.
 [[nodiscard]] std::optional<XMLNodeAdapter> getXMLTopNodeFromString(std::string_view xml,
-                                                                    std::string_view topNodeName);
\ No newline at end of file
+                                                                    std::string_view topNodeName);
+
+/// Retrieves the top-level XML node from a string and describes why that failed.
+/// @param xml The XML string to parse.
+/// @param topNodeName The name of the top node to retrieve.
+/// @return The top node adapter, or the syntax error with its position, or a missing node error.
+[[nodiscard]] FileParse::Expected<XMLNodeAdapter>
+  tryGetXMLTopNodeFromString(std::string_view xml, std::string_view topNodeName);
\ No newline at end of file
@@ -158,4 +158,50 @@ TEST_F(ArraySerializerTest, SerializeArrayOfEnumerators)
     };
 
     EXPECT_TRUE(Helper::compareNodes(adapter.getNode(), correctNodes()));
-}
\ No newline at end of file
+}
+
+TEST_F(ArraySerializerTest, DeserializeArrayStatus)
+{
+    Helper::MockNode elementNode{"Root"};
+    auto & child{Helper::addChildNode(elementNode, "Table")};
+    addChildNode(child, "Value", "1");
+    addChildNode(child, "Value", "2");
+    addChildNode(child, "Value", "3");
+    const Helper::MockNodeAdapter adapter{&elementNode};
+
+    std::array<double, 2> small{0, 0};
+    const auto overflow{FileParse::deserializeArray(adapter, {"Table", "Value"}, small)};
+    EXPECT_EQ(2u, overflow.decoded);
+    EXPECT_EQ(1u, overflow.overflow);
+    EXPECT_EQ(0u, overflow.underflow);
+    Helper::checkArrayValues({1, 2}, small, 1e-6);
+
+    std::array<double, 5> large{0, 0, 0, 0, -1};
+    const auto underflow{FileParse::deserializeArray(adapter, {"Table", "Value"}, large)};
+    EXPECT_EQ(3u, underflow.decoded);
+    EXPECT_EQ(0u, underflow.overflow);
+    EXPECT_EQ(2u, underflow.underflow);
+    Helper::checkArrayValues({1, 2, 3, 0, -1}, large, 1e-6);
+}
+
+TEST_F(ArraySerializerTest, EnumVectorArrayRoundTrip)
+{
+    const std::array<Helper::Day, 3> days{
+      Helper::Day::Monday, Helper::Day::Friday, Helper::Day::Sunday};
+
+    Helper::MockNode elementNode("Root");
+    Helper::MockNodeAdapter adapter{&elementNode};
+    FileParse::serializeEnumVector<Helper::MockNodeAdapter, Helper::Day>(
+      adapter, {"Table", "Day"}, days, Helper::toDayString);
+
+    std::array<Helper::Day, 4> loaded{
+      Helper::Day::None, Helper::Day::None, Helper::Day::None, Helper::Day::Tuesday};
+    const auto status{FileParse::deserializeEnumVector<Helper::MockNodeAdapter, Helper::Day>(
+      adapter, {"Table", "Day"}, loaded, Helper::toDay)};
+
+    EXPECT_EQ(3u, status.decoded);
+    EXPECT_EQ(1u, status.underflow);
+    Helper::checkArrayEquality(
+      {Helper::Day::Monday, Helper::Day::Friday, Helper::Day::Sunday, Helper::Day::Tuesday},
+      loaded);
+}
@@ -0,0 +1,219 @@
+/// Asynchronous loading and saving (XML and JSON) with cancellation and coroutines
+#include <chrono>
+#include <coroutine>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/FileDataHandler.hxx"
+
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+namespace
+{
+    // Minimal fire-and-forget coroutine that reports its result through a promise
+    struct DetachedTask
+    {
+        struct promise_type
+        {
+            DetachedTask get_return_object()
+            {
+                return {};
+            }
+            std::suspend_never initial_suspend() noexcept
+            {
+                return {};
+            }
+            std::suspend_never final_suspend() noexcept
+            {
+                return {};
+            }
+            void return_void()
+            {}
+            void unhandled_exception()
+            {
+                std::terminate();
+            }
+        };
+    };
+
+    DetachedTask loadWithCoroutine(std::string fileName, std::promise<std::string> & result)
+    {
+        const auto model{
+          co_await Common::loadFromFileAwaitable<Helper::BaseElement>(fileName, "BaseElement")};
+        result.set_value(model.has_value() ? model->text : "");
+    }
+
+    // Saves and reloads one after another, so every await is issued from a task of the executor.
+    // The executor is borrowed, so it is never destroyed by one of its own workers.
+    DetachedTask roundTripWithCoroutine(std::string fileName,
+                                        const std::shared_ptr<FileParse::Executor> & executor,
+                                        std::promise<std::string> & result)
+    {
+        Helper::BaseElement element;
+        element.text = "Awaited";
+        const auto status{co_await Common::saveToFileAwaitable(
+          element, fileName, "BaseElement", {}, executor)};
+        const auto model{co_await Common::loadFromFileAwaitable<Helper::BaseElement>(
+          fileName, "BaseElement", {}, executor)};
+        result.set_value(status == 0 && model.has_value() ? model->text : "");
+    }
+}   // namespace
+
+class AsyncFileHandlingTest : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        for(const auto & file : tempFiles)
+        {
+            std::filesystem::remove(file);
+        }
+    }
+
+    std::string addTempFile(const std::string & name)
+    {
+        tempFiles.push_back(name);
+        return name;
+    }
+
+    static std::string dataFile(const std::string & name)
+    {
+        return (std::filesystem::path{TEST_DATA_DIR} / name).string();
+    }
+
+    std::vector<std::string> tempFiles;
+};
+
+TEST_F(AsyncFileHandlingTest, LoadXMLAndJSONConcurrently)
+{
+    auto xml{Common::loadFromFileAsync<Helper::BaseElement>(dataFile("BaseElement.xml"),
+                                                            "BaseElement")};
+    auto json{Common::loadFromFileAsync<Helper::BaseElement>(dataFile("BaseElement.json"),
+                                                             "BaseElement")};
+
+    for(auto * future : {&xml, &json})
+    {
+        const auto model{future->get()};
+        ASSERT_TRUE(model.has_value());
+        EXPECT_EQ("TestText", model->text);
+        EXPECT_EQ(13, model->integer_number);
+        EXPECT_NEAR(3.1415926, model->double_number, 1e-6);
+    }
+}
+
+TEST_F(AsyncFileHandlingTest, LoadWrongRootReturnsNullopt)
+{
+    auto future{
+      Common::loadFromFileAsync<Helper::BaseElement>(dataFile("BaseElement.xml"), "Missing")};
+
+    EXPECT_FALSE(future.get().has_value());
+}
+
+TEST_F(AsyncFileHandlingTest, MissingFileIsNotCreated)
+{
+    const auto fileName{addTempFile("AsyncMissing.xml")};
+
+    EXPECT_FALSE(
+      Common::loadFromFileAsync<Helper::BaseElement>(fileName, "BaseElement").get().has_value());
+    EXPECT_FALSE(std::filesystem::exists(fileName));
+}
+
+TEST_F(AsyncFileHandlingTest, LoadWithByteOrderMark)
+{
+    const auto fileName{addTempFile("AsyncMarked.xml")};
+    {
+        std::ofstream file{fileName, std::ios::binary};
+        file << "\xEF\xBB\xBF<BaseElement><SampleText>Marked</SampleText></BaseElement>";
+    }
+
+    const auto loaded{
+      Common::loadFromFileAsync<Helper::BaseElement>(fileName, "BaseElement").get()};
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ("Marked", loaded->text);
+}
+
+TEST_F(AsyncFileHandlingTest, CancelledLoadThrows)
+{
+    FileParse::CancellationToken token;
+    token.cancel();
+
+    auto future{Common::loadFromFileAsync<Helper::BaseElement>(
+      dataFile("BaseElement.xml"), "BaseElement", token)};
+
+    EXPECT_THROW(future.get(), FileParse::OperationCancelled);
+}
+
+TEST_F(AsyncFileHandlingTest, SaveAndLoadRoundTrip)
+{
+    const auto fileName{addTempFile("AsyncRoundTrip.json")};
+
+    Helper::BaseElement element;
+    element.text = "Async";
+    element.integer_number = 42;
+
+    auto saved{Common::saveToFileAsync(element, fileName, "BaseElement")};
+    element.text = "Modified after the call";
+    ASSERT_EQ(0, saved.get());
+
+    const auto loaded{
+      Common::loadFromFileAsync<Helper::BaseElement>(fileName, "BaseElement").get()};
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ("Async", loaded->text);
+    EXPECT_EQ(42, loaded->integer_number);
+}
+
+TEST_F(AsyncFileHandlingTest, CancelledSaveDoesNotWrite)
+{
+    const auto fileName{addTempFile("AsyncCancelled.xml")};
+
+    FileParse::CancellationToken token;
+    token.cancel();
+
+    auto saved{Common::saveToFileAsync(Helper::BaseElement{}, fileName, "BaseElement", token)};
+
+    EXPECT_THROW(saved.get(), FileParse::OperationCancelled);
+    EXPECT_FALSE(std::filesystem::exists(fileName));
+}
+
+TEST_F(AsyncFileHandlingTest, SaveUnknownExtension)
+{
+    EXPECT_EQ(-1, Common::saveToFileAsync(Helper::BaseElement{}, "Async.txt", "BaseElement").get());
+}
+
+TEST_F(AsyncFileHandlingTest, AwaitFromCoroutine)
+{
+    std::promise<std::string> result;
+    auto text{result.get_future()};
+
+    loadWithCoroutine(dataFile("BaseElement.json"), result);
+
+    EXPECT_EQ("TestText", text.get());
+}
+
+TEST_F(AsyncFileHandlingTest, AwaitOnSingleWorker)
+{
+    const auto fileName{addTempFile("AsyncSingleWorker.xml")};
+    const auto executor{std::make_shared<FileParse::WorkStealingScheduler>(1u)};
+
+    std::promise<std::string> result;
+    auto text{result.get_future()};
+
+    roundTripWithCoroutine(fileName, executor, result);
+
+    ASSERT_EQ(std::future_status::ready, text.wait_for(std::chrono::seconds(10)));
+    EXPECT_EQ("Awaited", text.get());
+}
+
+TEST_F(AsyncFileHandlingTest, LoadOnGivenExecutor)
+{
+    const auto executor{std::make_shared<FileParse::WorkStealingScheduler>(1u)};
+
+    auto future{Common::loadFromFileAsync<Helper::BaseElement>(
+      dataFile("BaseElement.json"), "BaseElement", {}, executor)};
+
+    const auto model{future.get()};
+    ASSERT_TRUE(model.has_value());
+    EXPECT_EQ("TestText", model->text);
+}
@@ -0,0 +1,133 @@
+/// Concurrent read-only access to one parsed document from many threads. Build with
+/// -DFILEPARSE_ENABLE_TSAN=ON to have ThreadSanitizer check these tests for data races.
+#include <filesystem>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/FileDataHandler.hxx"
+#include "include/fileParse/Vector.hxx"
+
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+class ConcurrentReadsTest : public testing::Test
+{
+protected:
+    static constexpr size_t threadCount{8u};
+    static constexpr size_t iterations{50u};
+
+    // Runs the reader on all threads at the same time and counts the successful reads
+    template<typename Reader>
+    static size_t readConcurrently(Reader reader)
+    {
+        std::atomic<size_t> successes{0u};
+
+        std::vector<std::thread> threads;
+        for(size_t i = 0u; i < threadCount; ++i)
+        {
+            threads.emplace_back([&]() {
+                for(size_t j = 0u; j < iterations; ++j)
+                {
+                    if(reader())
+                    {
+                        ++successes;
+                    }
+                }
+            });
+        }
+        for(auto & thread : threads)
+        {
+            thread.join();
+        }
+
+        return successes;
+    }
+
+    template<typename NodeAdapter>
+    static bool readBaseElement(const NodeAdapter & node)
+    {
+        Helper::BaseElement element;
+        node >> element;
+
+        return element.text == "TestText" && element.integer_number == 13
+               && element.optional_text == "OptionalText";
+    }
+
+    template<typename NodeAdapter>
+    static bool readValues(const NodeAdapter & node, size_t expectedCount)
+    {
+        const auto table{node.getFirstChildByName("Table")};
+        if(!table.has_value() || table->nChildNode("Value") != static_cast<int>(expectedCount))
+        {
+            return false;
+        }
+
+        const auto children{table->getChildNodesByName("Value")};
+        for(size_t i = 0u; i < children.size(); ++i)
+        {
+            if(children[i].getText() != std::to_string(i))
+            {
+                return false;
+            }
+        }
+
+        return children.size() == expectedCount && table->getChildNodes().size() == expectedCount;
+    }
+
+    static std::vector<std::string> createValues()
+    {
+        std::vector<std::string> values;
+        for(size_t i = 0u; i < 200u; ++i)
+        {
+            values.push_back(std::to_string(i));
+        }
+        return values;
+    }
+};
+
+TEST_F(ConcurrentReadsTest, XMLDocument)
+{
+    const auto fileName{std::filesystem::path{TEST_DATA_DIR} / "BaseElement.xml"};
+    const auto node{getXMLTopNodeFromFile(fileName.string(), "BaseElement")};
+    ASSERT_TRUE(node.has_value());
+
+    EXPECT_EQ(threadCount * iterations,
+              readConcurrently([&]() { return readBaseElement(node.value()); }));
+}
+
+TEST_F(ConcurrentReadsTest, JSONDocument)
+{
+    const auto fileName{std::filesystem::path{TEST_DATA_DIR} / "BaseElement.json"};
+    const auto node{getJSONTopNodeFromFile(fileName.string(), "BaseElement")};
+    ASSERT_TRUE(node.has_value());
+
+    EXPECT_EQ(threadCount * iterations,
+              readConcurrently([&]() { return readBaseElement(node.value()); }));
+}
+
+TEST_F(ConcurrentReadsTest, XMLSiblingCollection)
+{
+    const auto values{createValues()};
+    auto document{createXMLTopNode("Root")};
+    document << FileParse::Child{{"Table", "Value"}, values};
+    const auto node{getXMLTopNodeFromString(document.getContent(), "Root")};
+    ASSERT_TRUE(node.has_value());
+
+    EXPECT_EQ(threadCount * iterations,
+              readConcurrently([&]() { return readValues(node.value(), values.size()); }));
+}
+
+TEST_F(ConcurrentReadsTest, JSONSiblingCollection)
+{
+    const auto values{createValues()};
+    auto document{createJSONTopNode("Root")};
+    document << FileParse::Child{{"Table", "Value"}, values};
+    const auto node{getJSONTopNodeFromString(document.getContent(), "Root")};
+    ASSERT_TRUE(node.has_value());
+
+    EXPECT_EQ(threadCount * iterations,
+              readConcurrently([&]() { return readValues(node.value(), values.size()); }));
+
+    // Reads must not have inserted anything into the document
+    EXPECT_EQ(document.getContent(), node->getContent());
+}
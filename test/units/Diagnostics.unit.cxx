@@ -0,0 +1,189 @@
+/// Decoding malformed values into a diagnostics sink instead of throwing (XML and JSON)
+#include <cmath>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/FileDataHandler.hxx"
+#include "include/fileParse/Array.hxx"
+#include "include/fileParse/Vector.hxx"
+
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/serializers/SerializerAttributes.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+namespace
+{
+    void checkMalformedNumbers(const std::string & data)
+    {
+        // Without a sink, the first malformed value aborts the load
+        EXPECT_EQ(FileParse::ErrorCategory::Decode,
+                  Common::tryLoadFromString<Helper::BaseElement>(data, "Root").error().category);
+
+        FileParse::DiagnosticsSink sink;
+        std::optional<Helper::BaseElement> element;
+        {
+            FileParse::ScopedDiagnostics scope{sink, "Root"};
+            element = Common::loadFromString<Helper::BaseElement>(data, "Root");
+        }
+
+        ASSERT_TRUE(element.has_value());
+        EXPECT_EQ("Text", element->text);
+        EXPECT_EQ(0, element->integer_number);
+        EXPECT_EQ(0.0, element->double_number);
+        EXPECT_EQ(9u, element->size_t_field);
+
+        const auto diagnostics{sink.diagnostics()};
+        ASSERT_EQ(2u, diagnostics.size());
+        EXPECT_EQ("Root/Integer", diagnostics[0].nodePath);
+        EXPECT_EQ("x12", diagnostics[0].text);
+        EXPECT_EQ("Root/Double", diagnostics[1].nodePath);
+        EXPECT_EQ("one", diagnostics[1].text);
+        EXPECT_FALSE(diagnostics[1].message.empty());
+    }
+}   // namespace
+
+TEST(DiagnosticsTest, MalformedNumbersXML)
+{
+    checkMalformedNumbers("<Root><SampleText>Text</SampleText><Integer>x12</Integer>"
+                          "<Double>one</Double><Size_t> 9 </Size_t></Root>");
+}
+
+TEST(DiagnosticsTest, MalformedNumbersJSON)
+{
+    checkMalformedNumbers(
+      R"({"Root": {"SampleText": "Text", "Integer": "x12", "Double": "one", "Size_t": "9"}})");
+}
+
+TEST(DiagnosticsTest, MalformedAttributes)
+{
+    FileParse::DiagnosticsSink sink;
+    FileParse::ScopedDiagnostics scope{sink};
+
+    const auto element{Common::loadFromXMLString<Helper::AttributesTest>(
+      R"(<AttributesTest Name="N" Age="x" Height="1.5" OptionalAge="" />)", "AttributesTest")};
+
+    ASSERT_TRUE(element.has_value());
+    EXPECT_EQ("N", element->name);
+    EXPECT_EQ(0, element->age);
+    EXPECT_EQ(1.5, element->height);
+    EXPECT_FALSE(element->optional_age.has_value());
+
+    const auto diagnostics{sink.diagnostics()};
+    ASSERT_EQ(2u, diagnostics.size());
+    EXPECT_EQ("Age", diagnostics[0].nodePath);
+    EXPECT_EQ("OptionalAge", diagnostics[1].nodePath);
+}
+
+TEST(DiagnosticsTest, ScopesNestAndRestore)
+{
+    FileParse::DiagnosticsSink outer;
+    FileParse::DiagnosticsSink inner;
+    int value{5};
+    {
+        FileParse::ScopedDiagnostics outerScope{outer, "Outer"};
+        {
+            FileParse::ScopedDiagnostics innerScope{inner};
+            FileParse::convertNumber("bad", value);
+        }
+        FileParse::DiagnosticsPathScope path{"Value"};
+        FileParse::convertNumber("bad", value);
+    }
+
+    EXPECT_EQ(5, value);
+    ASSERT_EQ(1u, inner.size());
+    EXPECT_EQ("", inner.diagnostics()[0].nodePath);
+    ASSERT_EQ(1u, outer.size());
+    EXPECT_EQ("Outer/Value", outer.diagnostics()[0].nodePath);
+    EXPECT_THROW(FileParse::convertNumber("bad", value), std::invalid_argument);
+    EXPECT_THROW(FileParse::convertNumber("99999999999", value), std::out_of_range);
+}
+
+TEST(DiagnosticsTest, SameGrammarWithAndWithoutSink)
+{
+    const auto convert{[](const std::string & text) {
+        int value{0};
+        FileParse::convertNumber(text, value);
+        return value;
+    }};
+
+    const auto withoutSink{convert(" 12abc")};
+
+    FileParse::DiagnosticsSink sink;
+    FileParse::ScopedDiagnostics scope{sink};
+    EXPECT_EQ(withoutSink, convert(" 12abc"));
+    EXPECT_EQ(0, convert("99999999999"));
+
+    ASSERT_EQ(1u, sink.size());
+    EXPECT_EQ("Value out of range", sink.diagnostics()[0].message);
+}
+
+TEST(DiagnosticsTest, GrammarMatchesStandardConversions)
+{
+    for(const std::string text : {"12", " \t-7", "+3", "42abc", "0x1A", "-0"})
+    {
+        int integer{0};
+        EXPECT_EQ(std::errc{}, FileParse::parseNumber(text, integer)) << text;
+        EXPECT_EQ(std::stoi(text), integer) << text;
+
+        size_t size{0u};
+        EXPECT_EQ(std::errc{}, FileParse::parseNumber(text, size)) << text;
+        EXPECT_EQ(std::stoul(text), size) << text;
+    }
+
+    for(const std::string text :
+        {"1.5", " -2.5e3", "+.5", "1.5abc", "0x1.8p1", "0x", "-0xAp-2", "1e", "inf", "-nan"})
+    {
+        double number{0.0};
+        EXPECT_EQ(std::errc{}, FileParse::parseNumber(text, number)) << text;
+        const auto expected{std::stod(text)};
+        if(std::isnan(expected))
+        {
+            EXPECT_TRUE(std::isnan(number)) << text;
+        }
+        else
+        {
+            EXPECT_EQ(expected, number) << text;
+        }
+    }
+
+    for(const std::string text : {"", " ", "abc", "+-1", "--1", "-", "x12", ".e1"})
+    {
+        int integer{5};
+        double number{5.0};
+        EXPECT_EQ(std::errc::invalid_argument, FileParse::parseNumber(text, integer)) << text;
+        EXPECT_EQ(std::errc::invalid_argument, FileParse::parseNumber(text, number)) << text;
+        EXPECT_EQ(5, integer);
+        EXPECT_EQ(5.0, number);
+    }
+
+    int integer{0};
+    double number{0.0};
+    EXPECT_EQ(std::errc::result_out_of_range, FileParse::parseNumber("99999999999", integer));
+    EXPECT_EQ(std::errc::result_out_of_range, FileParse::parseNumber("1e999", number));
+}
+
+TEST(DiagnosticsTest, MalformedPackedValues)
+{
+    const auto node{getXMLTopNodeFromString(
+      "<Root><Values>1 2 three</Values><Fixed>1 2 x</Fixed></Root>", "Root")};
+    ASSERT_TRUE(node.has_value());
+
+    std::vector<double> values{5.0};
+    std::array<int, 3> fixed{7, 8, 9};
+    EXPECT_THROW((node.value() >> FileParse::Packed{"Values", values}), std::invalid_argument);
+
+    FileParse::DiagnosticsSink sink;
+    {
+        FileParse::ScopedDiagnostics scope{sink, "Root"};
+        node.value() >> FileParse::Packed{"Values", values};
+        node.value() >> FileParse::Packed{"Fixed", fixed};
+    }
+
+    EXPECT_TRUE(values.empty());
+    EXPECT_EQ((std::array<int, 3>{7, 8, 9}), fixed);
+
+    const auto diagnostics{sink.diagnostics()};
+    ASSERT_EQ(2u, diagnostics.size());
+    EXPECT_EQ("Root/Values", diagnostics[0].nodePath);
+    EXPECT_EQ("1 2 three", diagnostics[0].text);
+    EXPECT_EQ("Root/Fixed", diagnostics[1].nodePath);
+}
@@ -0,0 +1,166 @@
+/// Cache of parsed documents keyed by path, size and modification time
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/FileDataHandler.hxx"
+
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+class DocumentCacheTest : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        std::filesystem::remove(fileName);
+    }
+
+    void writeFile(const std::string & text) const
+    {
+        std::ofstream out{fileName};
+        out << "<Root><Text>" << text << "</Text></Root>";
+    }
+
+    static std::string textOf(const std::shared_ptr<const NodeAdapter> & node)
+    {
+        return std::visit(
+          [](const auto & adapter) {
+              const auto child{adapter.getFirstChildByName("Text")};
+              return child.has_value() ? child->getText() : std::string{};
+          },
+          *node);
+    }
+
+    const std::string fileName{
+      (std::filesystem::temp_directory_path() / "DocumentCacheTest.xml").string()};
+};
+
+TEST_F(DocumentCacheTest, HitReturnsSameDocument)
+{
+    writeFile("First");
+    Common::DocumentCache cache;
+
+    const auto first{cache.getTopNodeFromFile(fileName, "Root")};
+    const auto second{cache.getTopNodeFromFile(fileName, "Root")};
+
+    ASSERT_NE(nullptr, first);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ("First", textOf(second));
+
+    const auto stats{cache.stats()};
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(1u, stats.entries);
+    EXPECT_EQ(std::filesystem::file_size(fileName), stats.bytes);
+}
+
+TEST_F(DocumentCacheTest, ChangedFileIsParsedAgain)
+{
+    writeFile("First");
+    Common::DocumentCache cache;
+    const auto first{cache.getTopNodeFromFile(fileName, "Root")};
+
+    writeFile("Changed content");
+    const auto second{cache.getTopNodeFromFile(fileName, "Root")};
+
+    ASSERT_NE(nullptr, second);
+    EXPECT_NE(first, second);
+    EXPECT_EQ("Changed content", textOf(second));
+    // The outdated document stays usable by whoever still holds it
+    EXPECT_EQ("First", textOf(first));
+    EXPECT_EQ(2u, cache.stats().misses);
+    EXPECT_EQ(1u, cache.stats().entries);
+}
+
+TEST_F(DocumentCacheTest, InvalidateAndClear)
+{
+    writeFile("First");
+    Common::DocumentCache cache;
+    ASSERT_NE(nullptr, cache.getTopNodeFromFile(fileName, "Root"));
+
+    EXPECT_EQ(1u, cache.invalidate(fileName));
+    EXPECT_EQ(0u, cache.stats().entries);
+
+    ASSERT_NE(nullptr, cache.getTopNodeFromFile(fileName, "Root"));
+    cache.clear();
+    EXPECT_EQ(0u, cache.stats().entries);
+    EXPECT_EQ(0u, cache.stats().bytes);
+    EXPECT_EQ(2u, cache.stats().misses);
+}
+
+TEST_F(DocumentCacheTest, MissingFileOrNode)
+{
+    Common::DocumentCache cache;
+    EXPECT_EQ(nullptr, cache.getTopNodeFromFile(fileName, "Root"));
+    EXPECT_FALSE(std::filesystem::exists(fileName));
+
+    writeFile("First");
+    EXPECT_EQ(nullptr, cache.getTopNodeFromFile(fileName, "Other"));
+    EXPECT_EQ(0u, cache.stats().entries);
+}
+
+TEST_F(DocumentCacheTest, ConcurrentHits)
+{
+    const auto dataFile{(std::filesystem::path{TEST_DATA_DIR} / "BaseElement.json").string()};
+    Common::DocumentCache cache;
+    const auto cached{cache.getTopNodeFromFile(dataFile, "BaseElement")};
+    ASSERT_NE(nullptr, cached);
+
+    std::atomic<size_t> matches{0u};
+    std::vector<std::thread> threads;
+    for(size_t i = 0u; i < 8u; ++i)
+    {
+        threads.emplace_back([&]() {
+            for(size_t j = 0u; j < 20u; ++j)
+            {
+                const auto node{cache.getTopNodeFromFile(dataFile, "BaseElement")};
+                Helper::BaseElement element;
+                std::get<JSONNodeAdapter>(*node) >> element;
+                if(node == cached && element.text == "TestText")
+                {
+                    ++matches;
+                }
+            }
+        });
+    }
+    for(auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(160u, matches);
+    EXPECT_EQ(160u, cache.stats().hits);
+}
+
+TEST(LruCacheTest, EvictsLeastRecentlyUsed)
+{
+    FileParse::LruCache<int, int> cache{10u};
+    cache.insert(1, std::make_shared<const int>(10), 4u);
+    cache.insert(2, std::make_shared<const int>(20), 4u);
+    ASSERT_NE(nullptr, cache.find(1));
+
+    cache.insert(3, std::make_shared<const int>(30), 4u);
+
+    EXPECT_EQ(nullptr, cache.find(2));
+    ASSERT_NE(nullptr, cache.find(1));
+    EXPECT_EQ(10, *cache.find(1));
+    EXPECT_EQ(30, *cache.find(3));
+
+    const auto stats{cache.stats()};
+    EXPECT_EQ(1u, stats.evictions);
+    EXPECT_EQ(2u, stats.entries);
+    EXPECT_EQ(8u, stats.bytes);
+}
+
+TEST(LruCacheTest, OversizedValueIsNotStored)
+{
+    FileParse::LruCache<int, int> cache{10u};
+    cache.insert(1, std::make_shared<const int>(10), 4u);
+    cache.insert(2, std::make_shared<const int>(20), 11u);
+
+    EXPECT_EQ(nullptr, cache.find(2));
+    EXPECT_NE(nullptr, cache.find(1));
+    EXPECT_EQ(0u, cache.stats().evictions);
+}
@@ -0,0 +1,102 @@
+/// Serializers generated from compile-time field descriptions
+#include <optional>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/Fields.hxx"
+#include "include/fileParse/FileDataHandler.hxx"
+#include "include/fileParse/Optional.hxx"
+#include "include/fileParse/Vector.hxx"
+
+namespace FieldsTest
+{
+    struct Material
+    {
+        std::string name;
+        double conductivity{0.0};
+    };
+
+    FILEPARSE_FIELDS(Material, (name, "Name"), (conductivity, "Conductivity"))
+
+    struct Layer
+    {
+        std::string name;
+        double thickness{0.0};
+        std::optional<int> index;
+        std::vector<double> values;
+        Material material;
+    };
+
+    FILEPARSE_FIELDS(Layer,
+                     (name, "Name"),
+                     (thickness, "Thickness"),
+                     (index, "Index"),
+                     (values, "Value"),
+                     (material, "Material"))
+
+    // The same layout with hand-written serializers
+    template<typename NodeAdapter>
+    NodeAdapter & writeByHand(NodeAdapter & node, const Layer & layer)
+    {
+        using FileParse::Child;
+        node << Child{"Name", layer.name};
+        node << Child{"Thickness", layer.thickness};
+        node << Child{"Index", layer.index};
+        node << Child{"Value", layer.values};
+        auto materialNode{node.addChild("Material")};
+        materialNode << Child{"Name", layer.material.name};
+        materialNode << Child{"Conductivity", layer.material.conductivity};
+        return node;
+    }
+
+    Layer createLayer()
+    {
+        return {"Glass", 0.006, 2, {0.5, 1.5}, {"Float glass", 1.0}};
+    }
+}   // namespace FieldsTest
+
+static_assert(FileParse::has_fields<FieldsTest::Layer>::value);
+static_assert(!FileParse::has_fields<std::string>::value);
+static_assert(std::tuple_size_v<decltype(FileParse::fieldsOf<FieldsTest::Layer>())> == 5u);
+static_assert(std::get<1>(FileParse::fieldsOf<FieldsTest::Layer>()).nodeNames.front()
+              == "Thickness");
+
+TEST(FieldsTest, SerializationMatchesHandWritten)
+{
+    const auto layer{FieldsTest::createLayer()};
+
+    auto expected{createXMLTopNode("Layer")};
+    FieldsTest::writeByHand(expected, layer);
+
+    EXPECT_EQ(expected.getContent(), Common::saveToXMLString(layer, "Layer"));
+}
+
+TEST(FieldsTest, RoundTripXML)
+{
+    const auto layer{FieldsTest::createLayer()};
+
+    const auto loaded{Common::loadFromXMLString<FieldsTest::Layer>(
+      Common::saveToXMLString(layer, "Layer"), "Layer")};
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ("Glass", loaded->name);
+    EXPECT_DOUBLE_EQ(0.006, loaded->thickness);
+    EXPECT_EQ(2, loaded->index);
+    EXPECT_EQ(layer.values, loaded->values);
+    EXPECT_EQ("Float glass", loaded->material.name);
+    EXPECT_DOUBLE_EQ(1.0, loaded->material.conductivity);
+}
+
+TEST(FieldsTest, RoundTripJSON)
+{
+    auto layer{FieldsTest::createLayer()};
+    layer.index.reset();
+
+    const auto loaded{Common::loadFromJSONString<FieldsTest::Layer>(
+      Common::saveToJSONString(layer, "Layer"), "Layer")};
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ("Glass", loaded->name);
+    EXPECT_FALSE(loaded->index.has_value());
+    EXPECT_EQ(layer.values, loaded->values);
+    EXPECT_EQ("Float glass", loaded->material.name);
+}
@@ -0,0 +1,145 @@
+/// Atomic replacement of files through a temporary file
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/FileDataHandler.hxx"
+#include "include/fileParse/FileWriter.hxx"
+
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+class FileWriterTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directory);
+    }
+
+    static std::string readFile(const std::filesystem::path & fileName)
+    {
+        std::ifstream file{fileName, std::ios::binary};
+        std::ostringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    size_t fileCount() const
+    {
+        return static_cast<size_t>(std::distance(std::filesystem::directory_iterator(directory),
+                                                 std::filesystem::directory_iterator()));
+    }
+
+    const std::filesystem::path directory{std::filesystem::temp_directory_path()
+                                          / "FileWriterTest"};
+    const std::filesystem::path fileName{directory / "Target.txt"};
+};
+
+TEST_F(FileWriterTest, CreatesAndReplaces)
+{
+    ASSERT_TRUE(FileParse::writeFileAtomically(fileName.string(), "First content"));
+    EXPECT_EQ("First content", readFile(fileName));
+
+    ASSERT_TRUE(FileParse::writeFileAtomically(fileName.string(), "Second", true));
+    EXPECT_EQ("Second", readFile(fileName));
+
+    // No temporary files are left behind
+    EXPECT_EQ(1u, fileCount());
+}
+
+TEST_F(FileWriterTest, UncommittedWriteKeepsTarget)
+{
+    ASSERT_TRUE(FileParse::writeFileAtomically(fileName.string(), "Original"));
+
+    {
+        FileParse::AtomicFileWriter writer{fileName.string()};
+        ASSERT_TRUE(writer.good());
+        writer.stream() << "Partial content";
+        EXPECT_EQ(2u, fileCount());
+    }
+
+    EXPECT_EQ("Original", readFile(fileName));
+    EXPECT_EQ(1u, fileCount());
+}
+
+TEST_F(FileWriterTest, MissingDirectoryFails)
+{
+    const auto missing{directory / "Missing" / "Target.txt"};
+
+    EXPECT_FALSE(FileParse::writeFileAtomically(missing.string(), "Content"));
+    EXPECT_FALSE(std::filesystem::exists(missing));
+}
+
+TEST_F(FileWriterTest, StreamedJSONMatchesContent)
+{
+    Helper::BaseElement element;
+    element.text = "Streamed";
+
+    auto node{createJSONTopNode("Root")};
+    node << element;
+    ASSERT_EQ(0, node.writeToFile((directory / "Streamed.json").string()));
+
+    EXPECT_EQ(node.getContent(), readFile(directory / "Streamed.json"));
+}
+
+TEST_F(FileWriterTest, SaveWithSync)
+{
+    Helper::BaseElement element;
+    element.text = "Durable";
+
+    const auto result{
+      Common::saveToFile(element, (directory / "Durable.xml").string(), "Root", {false, true})};
+    EXPECT_EQ(0, result.status);
+    EXPECT_TRUE(result.written);
+
+    const auto loaded{
+      Common::loadFromFile<Helper::BaseElement>((directory / "Durable.xml").string(), "Root")};
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ("Durable", loaded->text);
+    EXPECT_EQ(1u, fileCount());
+}
+
+TEST_F(FileWriterTest, SavedXMLMatchesContent)
+{
+    Helper::BaseElement element;
+    element.text = "Replaced";
+
+    const auto xmlFile{directory / "Saved.xml"};
+    ASSERT_TRUE(FileParse::writeFileAtomically(xmlFile.string(), "Original"));
+    ASSERT_EQ(0, Common::saveToXMLFile(element, xmlFile.string(), "Root"));
+
+    EXPECT_EQ(Common::saveToXMLString(element, "Root"), readFile(xmlFile));
+    EXPECT_EQ(1u, fileCount());
+}
+
+TEST_F(FileWriterTest, MissingDirectoryFailsXML)
+{
+    const auto missing{directory / "Missing" / "Target.xml"};
+
+    EXPECT_NE(0, Common::saveToXMLFile(Helper::BaseElement{}, missing.string(), "Root"));
+    EXPECT_FALSE(std::filesystem::exists(missing));
+}
+
+#ifndef _WIN32
+TEST_F(FileWriterTest, SavedXMLKeepsPermissions)
+{
+    using std::filesystem::perms;
+
+    const auto xmlFile{directory / "Permissions.xml"};
+    ASSERT_TRUE(FileParse::writeFileAtomically(xmlFile.string(), "Original"));
+    const auto permissions{perms::owner_read | perms::owner_write | perms::group_read};
+    std::filesystem::permissions(xmlFile, permissions);
+
+    ASSERT_EQ(0, Common::saveToXMLFile(Helper::BaseElement{}, xmlFile.string(), "Root"));
+
+    EXPECT_EQ(permissions, std::filesystem::status(xmlFile).permissions() & perms::all);
+    EXPECT_EQ(1u, fileCount());
+}
+#endif
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "include/fileParse/Formatter.hxx"
+
+namespace
+{
+    // Stream based formatting that formatDouble has to reproduce
+    std::string referenceFormat(double value, int precision, double lowerBound, double upperBound)
+    {
+        const bool useScientific{(std::abs(value) < lowerBound || std::abs(value) > upperBound)
+                                 && value != 0.0};
+
+        std::ostringstream stream;
+        stream.setf(useScientific ? std::ios::scientific : std::ios::fixed, std::ios::floatfield);
+        stream.precision(precision);
+        stream << value;
+
+        auto str{stream.str()};
+        if(str.find('.') == std::string::npos)
+        {
+            return str;
+        }
+
+        const auto mantissaEnd{useScientific ? str.find_first_of("eE") : str.size()};
+        auto trimmed{str.find_last_not_of('0', mantissaEnd - 1) + 1};
+        if(str[trimmed - 1] == '.')
+        {
+            --trimmed;
+        }
+        str.erase(trimmed, mantissaEnd - trimmed);
+
+        return str;
+    }
+}   // namespace
+
+TEST(Formatter, FormatDouble)
+{
+    EXPECT_EQ("0", FileParse::formatDouble(0.0, 6));
+    EXPECT_EQ("1.5", FileParse::formatDouble(1.5, 6));
+    EXPECT_EQ("-25.5758", FileParse::formatDouble(-25.5758, 6));
+    EXPECT_EQ("1e-05", FileParse::formatDouble(1e-5, 6));
+    EXPECT_EQ("1.25e+06", FileParse::formatDouble(1.25e6, 6));
+    EXPECT_EQ("100000", FileParse::formatDouble(100000.0, 6));
+    EXPECT_EQ("3", FileParse::formatDouble(3.0000001, 6));
+}
+
+TEST(Formatter, FormatDoubleMatchesStream)
+{
+    std::mt19937_64 generator{2024};
+    std::uniform_real_distribution<double> mantissa{-10.0, 10.0};
+    std::uniform_int_distribution<int> exponent{-12, 12};
+    std::uniform_int_distribution<int> precision{0, 17};
+
+    for(size_t i = 0u; i < 5000u; ++i)
+    {
+        const auto value{mantissa(generator) * std::pow(10.0, exponent(generator))};
+        const auto digits{precision(generator)};
+        EXPECT_EQ(referenceFormat(value, digits, 0.001, 100000),
+                  FileParse::formatDouble(value, digits))
+          << value << " with precision " << digits;
+    }
+}
+
+TEST(Formatter, FormatDoubleLargeFixedValue)
+{
+    const auto value{std::numeric_limits<double>::max()};
+    EXPECT_EQ(referenceFormat(value, 6, 0.0, std::numeric_limits<double>::infinity()),
+              FileParse::formatDouble(value, 6, 0.0, std::numeric_limits<double>::infinity()));
+}
+
+TEST(Formatter, FormatDoublesIntoSingleBuffer)
+{
+    const std::vector<double> values{38.8048, 0.0, -1e-7, 250000.0};
+
+    std::string output{"Values:"};
+    FileParse::formatDoubles(values, output, 6, 0.001, 100000, ',');
+
+    EXPECT_EQ("Values:38.8048,0,-1e-07,2.5e+05", output);
+}
@@ -0,0 +1,161 @@
+/// JSON documents allocating their nodes from a per-document arena (with FILEPARSE_JSON_ARENA)
+#include <memory_resource>
+#include <vector>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "include/fileParse/Arena.hxx"
+#include "include/fileParse/FileDataHandler.hxx"
+
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+namespace
+{
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        size_t allocations{0u};
+        size_t deallocations{0u};
+
+    private:
+        void * do_allocate(size_t bytes, size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void * pointer, size_t bytes, size_t alignment) override
+        {
+            ++deallocations;
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const memory_resource & other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    class JSONArenaTest : public testing::Test
+    {
+    protected:
+        void TearDown() override
+        {
+            setJSONArenaSize(defaultSize);
+        }
+
+        const size_t defaultSize{getJSONArenaSize()};
+    };
+}   // namespace
+
+TEST_F(JSONArenaTest, AllocatorUsesCurrentArena)
+{
+    CountingResource resource;
+    std::vector<int, FileParse::ArenaAllocator<int>> heapValues{1, 2, 3};
+    {
+        FileParse::ScopedArena arena{&resource};
+        std::vector<int, FileParse::ArenaAllocator<int>> values{4, 5, 6};
+        EXPECT_EQ(1u, resource.allocations);
+
+        // Growing takes the new block from the arena and frees the old one to its own source
+        heapValues.push_back(4);
+        values.push_back(7);
+        EXPECT_EQ(3u, resource.allocations);
+        EXPECT_EQ(1u, resource.deallocations);
+    }
+    // Arena blocks are returned to their arena even outside the scope
+    EXPECT_EQ(4u, heapValues.size());
+    heapValues.clear();
+    heapValues.shrink_to_fit();
+    EXPECT_EQ(3u, resource.deallocations);
+}
+
+TEST_F(JSONArenaTest, SameContentWithAndWithoutArena)
+{
+    Helper::BaseElement element;
+    element.text = "Arena";
+    element.integer_number = 3;
+    const auto withArena{Common::saveToJSONString(element, "Root")};
+
+    setJSONArenaSize(0u);
+    const auto withoutArena{Common::saveToJSONString(element, "Root")};
+    EXPECT_EQ(withArena, withoutArena);
+
+    const auto loaded{Common::loadFromJSONString<Helper::BaseElement>(withArena, "Root")};
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ("Arena", loaded->text);
+}
+
+TEST_F(JSONArenaTest, ChildKeepsDocumentAlive)
+{
+    std::optional<JSONNodeAdapter> child;
+    {
+        const auto top{getJSONTopNodeFromString(R"({"Root": {"Name": "Kept"}})", "Root")};
+        ASSERT_TRUE(top.has_value());
+        child = top->getFirstChildByName("Name");
+    }
+
+    ASSERT_TRUE(child.has_value());
+    EXPECT_EQ("Kept", child->getText());
+}
+
+TEST_F(JSONArenaTest, AppendedNodesOutliveTheirDocument)
+{
+    auto top{createJSONTopNode("Root")};
+    {
+        auto detached{top.createDetachedNode("Item")};
+        detached.addChild("Name").addText("Moved");
+        top.appendChild(detached);
+    }
+
+    FileParse::Json value = FileParse::Json::object();
+    JSONNodeAdapter external{&value, "Root"};
+    {
+        auto detached{top.createDetachedNode("Item")};
+        detached.addChild("Name").addText("Copied");
+        external.appendChild(detached);
+    }
+
+    EXPECT_EQ("Moved", top.getFirstChildByName("Item")->getFirstChildByName("Name")->getText());
+    EXPECT_EQ("Copied",
+              external.getFirstChildByName("Item")->getFirstChildByName("Name")->getText());
+}
+
+#ifndef FILEPARSE_JSON_ARENA
+TEST_F(JSONArenaTest, WrapsNlohmannJson)
+{
+    nlohmann::json value = nlohmann::json::object();
+    JSONNodeAdapter adapter{&value, "Root"};
+    adapter.addChild("Name").addText("Plain");
+    adapter.addAttribute("Unit", "m");
+
+    EXPECT_EQ("Plain", value["Name"].get<std::string>());
+    EXPECT_EQ("m", adapter.getAttribute("Unit"));
+}
+#endif
+
+TEST_F(JSONArenaTest, LongStringsAndDetachedNodes)
+{
+    // Longer than any short-string buffer, so the strings are allocated
+    const std::string key(100u, 'k');
+    const std::string text(1000u, 't');
+
+    setJSONArenaSize(1024u * 1024u);
+    auto top{createJSONTopNode("Root")};
+    top.addChild(key).addText(text);
+    for(size_t i = 0u; i < 100u; ++i)
+    {
+        auto detached{top.createDetachedNode("Item")};
+        detached.addText(text + std::to_string(i));
+        top.appendChild(detached);
+    }
+
+    const auto loaded{getJSONTopNodeFromString(top.getContent(), "Root")};
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(text, loaded->getFirstChildByName(key)->getText());
+
+    const auto items{loaded->getChildNodesByName("Item")};
+    ASSERT_EQ(100u, items.size());
+    EXPECT_EQ(text + "99", items.back().getText());
+}
@@ -124,6 +124,20 @@ TEST(JSONNodeAdapter, NChildNode)
     EXPECT_EQ(0, node.nChildNode("NonExistent"));
 }
 
+TEST(JSONNodeAdapter, CountChildren)
+{
+    auto node = createJSONTopNode("TestRoot");
+    [[maybe_unused]] auto c1 = node.addChild("Item");
+    [[maybe_unused]] auto c2 = node.addChild("Other");
+    [[maybe_unused]] auto c3 = node.addChild("Item");
+    [[maybe_unused]] auto c4 = node.addChild("Item");
+
+    EXPECT_EQ(3u, node.countChildren("Item"));
+    EXPECT_EQ(1u, node.countChildren("Other"));
+    EXPECT_EQ(0u, node.countChildren("NonExistent"));
+    EXPECT_FALSE(node.hasChildNode("NonExistent"));
+}
+
 TEST(JSONNodeAdapter, HasChildNode)
 {
     auto node = createJSONTopNode("TestRoot");
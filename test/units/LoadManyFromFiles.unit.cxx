@@ -0,0 +1,87 @@
+/// Batch loading of many files (XML and JSON) on multiple threads
+#include <chrono>
+#include <filesystem>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/FileDataHandler.hxx"
+
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+class LoadManyFromFilesTest : public testing::Test
+{
+protected:
+    static std::vector<std::filesystem::path> dataFiles(size_t count)
+    {
+        const std::filesystem::path productPath{TEST_DATA_DIR};
+
+        std::vector<std::filesystem::path> files;
+        for(size_t i = 0u; i < count; ++i)
+        {
+            files.push_back(productPath / (i % 2 == 0 ? "BaseElement.xml" : "BaseElement.json"));
+        }
+        return files;
+    }
+};
+
+TEST_F(LoadManyFromFilesTest, LoadsAllFilesInOrder)
+{
+    const auto files{dataFiles(64u)};
+
+    const auto results{
+      Common::loadManyFromFiles<Helper::BaseElement>(files, "BaseElement", {4u, 4096u, nullptr})};
+
+    ASSERT_EQ(files.size(), results.size());
+    for(const auto & result : results)
+    {
+        ASSERT_TRUE(result.value.has_value()) << result.error;
+        EXPECT_TRUE(result.error.empty());
+        EXPECT_EQ("TestText", result.value->text);
+        EXPECT_EQ(13, result.value->integer_number);
+        EXPECT_NEAR(3.1415926, result.value->double_number, 1e-6);
+    }
+}
+
+TEST_F(LoadManyFromFilesTest, ReportsErrorsPerFile)
+{
+    auto files{dataFiles(3u)};
+    files.insert(files.begin() + 1, std::filesystem::path{TEST_DATA_DIR} / "DoesNotExist.xml");
+
+    const auto results{Common::loadManyFromFiles<Helper::BaseElement>(files, "BaseElement")};
+
+    ASSERT_EQ(4u, results.size());
+    EXPECT_TRUE(results[0].value.has_value());
+    EXPECT_FALSE(results[1].value.has_value());
+    EXPECT_NE(std::string::npos, results[1].error.find("DoesNotExist.xml"));
+    EXPECT_TRUE(results[2].value.has_value());
+    EXPECT_TRUE(results[3].value.has_value());
+
+    EXPECT_FALSE(std::filesystem::exists(files[1]));
+}
+
+TEST_F(LoadManyFromFilesTest, ParallelForRethrowsFirstError)
+{
+    // Slow tasks so that the remaining ones would take long if scheduling did not stop
+    constexpr size_t taskCount{1000u};
+    std::atomic<size_t> calls{0u};
+    std::string message;
+    try
+    {
+        FileParse::parallelFor(taskCount, 4u, [&](size_t index) {
+            ++calls;
+            if(index == 10u)
+            {
+                throw std::runtime_error("Task failed");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        });
+    }
+    catch(const std::runtime_error & error)
+    {
+        message = error.what();
+    }
+
+    EXPECT_EQ("Task failed", message);
+    EXPECT_LT(calls.load(), taskCount / 2u);
+}
@@ -0,0 +1,109 @@
+/// Loading with options, without creating missing files (XML and JSON)
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/FileDataHandler.hxx"
+
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+class LoadOptionsTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::filesystem::create_directories(directory);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directory);
+    }
+
+    std::string path(const std::string & name) const
+    {
+        return (directory / name).string();
+    }
+
+    void writeFile(const std::string & name, const std::string & content) const
+    {
+        std::ofstream out{directory / name, std::ios::binary};
+        out << content;
+    }
+
+    const std::filesystem::path directory{std::filesystem::temp_directory_path()
+                                          / "LoadOptionsTest"};
+};
+
+TEST_F(LoadOptionsTest, MissingFileIsNotCreated)
+{
+    const Common::LoadOptions options{false};
+
+    for(const auto * name : {"Missing.xml", "Missing.json", "Missing.txt"})
+    {
+        EXPECT_FALSE(Common::loadFromFile<Helper::BaseElement>(path(name), "Root", options));
+        EXPECT_FALSE(std::filesystem::exists(path(name)));
+    }
+    EXPECT_FALSE(
+      Common::loadFromXMLFile<Helper::BaseElement>(path("Missing.cfg"), "Root", options));
+    EXPECT_FALSE(
+      Common::loadFromJSONFile<Helper::BaseElement>(path("Missing.cfg"), "Root", options));
+    EXPECT_FALSE(std::filesystem::exists(path("Missing.cfg")));
+}
+
+TEST_F(LoadOptionsTest, MissingFileIsCreated)
+{
+    const auto xml{Common::loadFromFile<Helper::BaseElement>(path("New.xml"), "Root", {})};
+    const auto json{Common::loadFromFile<Helper::BaseElement>(path("New.json"), "Root", {})};
+
+    EXPECT_TRUE(xml.has_value());
+    EXPECT_TRUE(json.has_value());
+    EXPECT_TRUE(std::filesystem::exists(path("New.xml")));
+    EXPECT_TRUE(std::filesystem::exists(path("New.json")));
+
+    // The created files load the same way as with the default functions
+    EXPECT_TRUE(Common::loadFromFile<Helper::BaseElement>(path("New.xml"), "Root"));
+    EXPECT_TRUE(Common::loadFromFile<Helper::BaseElement>(path("New.json"), "Root"));
+}
+
+TEST_F(LoadOptionsTest, LoadsExistingFiles)
+{
+    Helper::BaseElement element;
+    element.text = "Loaded";
+    element.integer_number = 12;
+    ASSERT_EQ(0, Common::saveToFile(element, path("Element.xml"), "Root"));
+    ASSERT_EQ(0, Common::saveToFile(element, path("Element.json"), "Root"));
+
+    const Common::LoadOptions options{false};
+    for(const auto * name : {"Element.xml", "Element.json"})
+    {
+        const auto loaded{Common::loadFromFile<Helper::BaseElement>(path(name), "Root", options)};
+        ASSERT_TRUE(loaded.has_value());
+        EXPECT_EQ("Loaded", loaded->text);
+        EXPECT_EQ(12, loaded->integer_number);
+    }
+}
+
+TEST_F(LoadOptionsTest, FormatFromContent)
+{
+    writeFile("Element.data", "<Root><SampleText>Detected</SampleText></Root>");
+
+    const auto loaded{
+      Common::loadFromFile<Helper::BaseElement>(path("Element.data"), "Root", {false})};
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ("Detected", loaded->text);
+}
+
+TEST_F(LoadOptionsTest, ByteOrderMark)
+{
+    writeFile("Bom.xml", "\xEF\xBB\xBF<Root><SampleText>Marked</SampleText></Root>");
+    writeFile("Bom.json", "\xEF\xBB\xBF{\"Root\": {\"SampleText\": \"Marked\"}}");
+
+    for(const auto * name : {"Bom.xml", "Bom.json"})
+    {
+        const auto loaded{Common::loadFromFile<Helper::BaseElement>(path(name), "Root", {false})};
+        ASSERT_TRUE(loaded.has_value());
+        EXPECT_EQ("Marked", loaded->text);
+    }
+}
@@ -46,6 +46,20 @@ TEST_F(MapSameChildsTest, DeserializeMapStringDouble)
     Helper::checkMapValuesEqual(correct, testMap);
 }
 
+TEST_F(MapSameChildsTest, DeserializeUnorderedMapString)
+{
+    auto elementNode(createTestMap());
+    const Helper::MockNodeAdapter adapter{&elementNode};
+
+    std::unordered_map<std::string, std::string> testMap;
+    FileParse::deserializeMapAsChilds(adapter, {"Child", "Key", "Value"}, testMap);
+
+    EXPECT_EQ(3u, testMap.size());
+    EXPECT_EQ("Value1", testMap.at("Key1"));
+    EXPECT_EQ("Value2", testMap.at("Key2"));
+    EXPECT_EQ("Value3", testMap.at("Key3"));
+}
+
 TEST_F(MapSameChildsTest, SerializeMapStringDouble)
 {
     std::map<std::string, std::string> testMap{{"Key1", "Value1"},
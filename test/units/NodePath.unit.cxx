@@ -0,0 +1,88 @@
+/// Node paths describing the children of Child, stored inline for short paths
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/NodePath.hxx"
+#include "include/fileParse/Packed.hxx"
+#include "include/fileParse/Parallel.hxx"
+#include "include/fileParse/Vector.hxx"
+
+#include "test/helper/MockNodeAdapter.hxx"
+#include "test/helper/Utility.hxx"
+
+namespace
+{
+    constexpr FileParse::NodePath conductivityPath{"Layer", "Material", "Conductivity"};
+
+    static_assert(conductivityPath.size() == 3u);
+    static_assert(conductivityPath.front() == "Layer");
+    static_assert(conductivityPath.back() == "Conductivity");
+    static_assert(FileParse::NodePath{"Value"}.size() == 1u);
+    static_assert(FileParse::NodePath{}.empty());
+
+    // The wrappers view their names, so names held by a temporary string are rejected
+    using Names = std::vector<std::string>;
+    static_assert(std::is_constructible_v<FileParse::Child<int>, const std::string &, int &>);
+    static_assert(!std::is_constructible_v<FileParse::Child<int>, std::string, int &>);
+    static_assert(!std::is_constructible_v<FileParse::Child<int>, Names, int &>);
+    static_assert(std::is_constructible_v<FileParse::Packed<Names>, const char *, Names &>);
+    static_assert(!std::is_constructible_v<FileParse::Packed<Names>, std::string, Names &>);
+    static_assert(std::is_constructible_v<FileParse::ParallelChild<Names>, const Names &, Names &>);
+    static_assert(!std::is_constructible_v<FileParse::ParallelChild<Names>, Names, Names &>);
+}   // namespace
+
+TEST(NodePathTest, Constructors)
+{
+    const std::string name{"Value"};
+    const std::vector<std::string> names{"Table", "Row", "Value"};
+
+    EXPECT_EQ("Value", FileParse::NodePath{name}.front());
+    EXPECT_EQ(name.data(), FileParse::NodePath{name}.front().data());
+
+    const FileParse::NodePath path{names};
+    ASSERT_EQ(3u, path.size());
+    EXPECT_EQ("Row", path[1]);
+    EXPECT_EQ(names, std::vector<std::string>(path.begin(), path.end()));
+}
+
+TEST(NodePathTest, LongPathsAreStoredOnTheHeap)
+{
+    const FileParse::NodePath path{"A", "B", "C", "D", "E", "F"};
+    ASSERT_EQ(6u, path.size());
+    EXPECT_EQ("A", path.front());
+    EXPECT_EQ("F", path.back());
+
+    // Copies keep their own names
+    const auto copy{path};
+    EXPECT_EQ(std::vector<std::string_view>(path.begin(), path.end()),
+              std::vector<std::string_view>(copy.begin(), copy.end()));
+}
+
+TEST(NodePathTest, ChildWithLongPath)
+{
+    const std::vector<int> values{1, 2, 3};
+
+    Helper::MockNode elementNode{"Root"};
+    Helper::MockNodeAdapter adapter{&elementNode};
+    adapter << FileParse::Child{{"A", "B", "C", "D", "E", "Value"}, values};
+
+    std::vector<int> loaded;
+    std::as_const(adapter) >> FileParse::Child{{"A", "B", "C", "D", "E", "Value"}, loaded};
+    EXPECT_EQ(values, loaded);
+}
+
+TEST(NodePathTest, ChildFromCompileTimePath)
+{
+    const std::vector<double> values{0.5, 1.5};
+
+    Helper::MockNode elementNode{"Root"};
+    Helper::MockNodeAdapter adapter{&elementNode};
+    adapter << FileParse::Child{conductivityPath, values};
+
+    std::vector<double> loaded;
+    std::as_const(adapter) >> FileParse::Child{conductivityPath, loaded};
+    Helper::checkVectorValues(values, loaded, 1e-9);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "include/fileParse/NumberParser.hxx"
+#include "include/fileParse/Packed.hxx"
+
+TEST(NumberParser, CountValues)
+{
+    EXPECT_EQ(0u, FileParse::countValues(""));
+    EXPECT_EQ(0u, FileParse::countValues(" \t\r\n, "));
+    EXPECT_EQ(1u, FileParse::countValues("42"));
+    EXPECT_EQ(4u, FileParse::countValues("  1,2\n3\t\t4,"));
+    EXPECT_EQ(3u, FileParse::countValues("1.0000000000000000000001 2 3.5e-300"));
+}
+
+TEST(NumberParser, ParseDoubles)
+{
+    const std::string text{" 38.8048, 25.5758\n-96.1831\t1e-5 +2.5E3 .5 7. -0 12345678901234567890"};
+
+    std::vector<double> values(FileParse::countValues(text));
+    ASSERT_EQ(9u, values.size());
+    EXPECT_EQ(9u, FileParse::parseDoubles(text, values));
+
+    const std::vector<double> correct{
+      38.8048, 25.5758, -96.1831, 1e-5, 2500.0, 0.5, 7.0, -0.0, 12345678901234567890.0};
+    for(size_t i = 0u; i < correct.size(); ++i)
+    {
+        EXPECT_EQ(correct[i], values[i]) << "Index " << i;
+    }
+    EXPECT_TRUE(std::signbit(values[7]));
+}
+
+TEST(NumberParser, ParseDoublesMatchesStrtod)
+{
+    std::mt19937_64 generator{12345};
+    std::uniform_real_distribution<double> mantissa{-1.0, 1.0};
+    std::uniform_int_distribution<int> exponent{-30, 30};
+    std::uniform_int_distribution<int> digits{1, 17};
+
+    std::string text;
+    std::vector<double> correct;
+    for(size_t i = 0u; i < 2000u; ++i)
+    {
+        char buffer[64];
+        std::snprintf(buffer,
+                      sizeof(buffer),
+                      i % 2 == 0 ? "%.*g" : "%.*f",
+                      digits(generator),
+                      mantissa(generator) * std::pow(10.0, exponent(generator) % 10));
+        text += buffer;
+        text += i % 3 == 0 ? "," : " ";
+        correct.push_back(std::strtod(buffer, nullptr));
+    }
+
+    std::vector<double> values(correct.size());
+    ASSERT_EQ(correct.size(), FileParse::parseDoubles(text, values));
+    for(size_t i = 0u; i < correct.size(); ++i)
+    {
+        EXPECT_EQ(0, std::memcmp(&correct[i], &values[i], sizeof(double))) << "Index " << i;
+    }
+}
+
+TEST(NumberParser, ParseStopsWhenStorageIsFull)
+{
+    std::vector<double> values(2, 0.0);
+    EXPECT_EQ(2u, FileParse::parseDoubles("1 2 3 4", values));
+    EXPECT_EQ(2.0, values[1]);
+
+    std::vector<double> more(4, -1.0);
+    EXPECT_EQ(2u, FileParse::parseDoubles("1 2", more));
+    EXPECT_EQ(-1.0, more[2]);
+}
+
+TEST(NumberParser, ParseInts)
+{
+    std::vector<int> values(5);
+    EXPECT_EQ(5u, FileParse::parseInts("1, -22 +333\n4444 0", values));
+    EXPECT_EQ((std::vector<int>{1, -22, 333, 4444, 0}), values);
+
+    std::vector<unsigned long long> large(1);
+    EXPECT_EQ(1u, FileParse::parseInts("18446744073709551615", large));
+    EXPECT_EQ(18446744073709551615ull, large[0]);
+}
+
+TEST(NumberParser, InvalidValuesThrow)
+{
+    std::vector<double> doubles(4);
+    EXPECT_THROW(FileParse::parseDoubles("1.5 abc", doubles), std::invalid_argument);
+    EXPECT_THROW(FileParse::parseDoubles("1.5e", doubles), std::invalid_argument);
+    EXPECT_THROW(FileParse::parseDoubles("--1", doubles), std::invalid_argument);
+
+    std::vector<int> ints(4);
+    EXPECT_THROW(FileParse::parseInts("1.5", ints), std::invalid_argument);
+    EXPECT_THROW(FileParse::parseInts("+-1", ints), std::invalid_argument);
+    EXPECT_THROW(FileParse::parseInts("99999999999", ints), std::out_of_range);
+}
+
+TEST(NumberParser, PackedValuesOfOtherTypes)
+{
+    EXPECT_EQ((std::vector<float>{1.5f, -2.25f}), FileParse::parsePackedValues<float>("1.5 -2.25"));
+    EXPECT_EQ((std::vector<short>{7, -8}), FileParse::parsePackedValues<short>("7,-8"));
+}
+
+TEST(NumberParser, PackedValuesOutOfRange)
+{
+    EXPECT_THROW(FileParse::parsePackedValues<short>("1 40000"), std::out_of_range);
+    EXPECT_THROW(FileParse::parsePackedValues<unsigned short>("-1"), std::out_of_range);
+    EXPECT_THROW(FileParse::parsePackedValues<signed char>("128"), std::out_of_range);
+    EXPECT_THROW(FileParse::parsePackedValues<float>("1e39"), std::out_of_range);
+    EXPECT_EQ((std::vector<unsigned short>{0, 65535}),
+              FileParse::parsePackedValues<unsigned short>("0 65535"));
+    EXPECT_TRUE(std::isinf(FileParse::parsePackedValues<float>("inf").front()));
+}
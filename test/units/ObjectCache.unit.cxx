@@ -0,0 +1,126 @@
+/// Cache of decoded objects keyed by type, path, node name and file stamp
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/FileDataHandler.hxx"
+
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+class ObjectCacheTest : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        std::filesystem::remove(fileName);
+    }
+
+    void writeElement(const std::string & text) const
+    {
+        Helper::BaseElement element;
+        element.text = text;
+        ASSERT_EQ(0, Common::saveToFile(element, fileName, "BaseElement"));
+    }
+
+    const std::string fileName{
+      (std::filesystem::temp_directory_path() / "ObjectCacheTest.json").string()};
+};
+
+TEST_F(ObjectCacheTest, HitReturnsSameObject)
+{
+    writeElement("First");
+    Common::ObjectCache cache;
+
+    const auto first{
+      Common::loadFromFileCached<Helper::BaseElement>(fileName, "BaseElement", cache)};
+    const auto second{
+      Common::loadFromFileCached<Helper::BaseElement>(fileName, "BaseElement", cache)};
+
+    ASSERT_TRUE(first);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ("First", second->text);
+
+    const auto stats{cache.stats()};
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(std::filesystem::file_size(fileName), stats.bytes);
+}
+
+TEST_F(ObjectCacheTest, TypesAreCachedSeparately)
+{
+    writeElement("First");
+    Common::ObjectCache cache;
+
+    const auto element{cache.load<Helper::BaseElement>(fileName, "BaseElement")};
+    const auto text{cache.load<Helper::TextElement>(fileName, "BaseElement")};
+
+    ASSERT_TRUE(element);
+    ASSERT_TRUE(text);
+    EXPECT_EQ(2u, cache.stats().entries);
+
+    EXPECT_EQ(2u, cache.invalidate(fileName));
+    EXPECT_EQ(0u, cache.stats().entries);
+}
+
+TEST_F(ObjectCacheTest, ChangedFileIsDecodedAgain)
+{
+    writeElement("First");
+    Common::ObjectCache cache;
+    const auto first{cache.load<Helper::BaseElement>(fileName, "BaseElement")};
+
+    writeElement("Second version");
+    const auto second{cache.load<Helper::BaseElement>(fileName, "BaseElement")};
+
+    ASSERT_TRUE(second);
+    EXPECT_EQ("Second version", second->text);
+    EXPECT_EQ("First", first->text);
+}
+
+TEST_F(ObjectCacheTest, ContentHashDetectsSameSizeChange)
+{
+    writeElement("AAAA");
+    Common::ObjectCache plain;
+    Common::ObjectCache hashed{{size_t{1024u} * 1024u, true}};
+    ASSERT_TRUE(plain.load<Helper::BaseElement>(fileName, "BaseElement"));
+    ASSERT_TRUE(hashed.load<Helper::BaseElement>(fileName, "BaseElement"));
+
+    // Same size and modification time, different content
+    const auto modified{std::filesystem::last_write_time(fileName)};
+    writeElement("BBBB");
+    std::filesystem::last_write_time(fileName, modified);
+
+    EXPECT_EQ("AAAA", plain.load<Helper::BaseElement>(fileName, "BaseElement")->text);
+    EXPECT_EQ("BBBB", hashed.load<Helper::BaseElement>(fileName, "BaseElement")->text);
+}
+
+TEST_F(ObjectCacheTest, MissingFileIsNotCreated)
+{
+    EXPECT_FALSE(Common::loadFromFileCached<Helper::BaseElement>(fileName, "BaseElement"));
+    EXPECT_FALSE(std::filesystem::exists(fileName));
+}
+
+TEST_F(ObjectCacheTest, ContentHashWithByteOrderMark)
+{
+    const auto xmlFileName{
+      (std::filesystem::temp_directory_path() / "ObjectCacheTest.xml").string()};
+    {
+        std::ofstream file{xmlFileName, std::ios::binary};
+        file << "\xEF\xBB\xBF<BaseElement><SampleText>Marked</SampleText></BaseElement>";
+    }
+
+    Common::ObjectCache hashed{{size_t{1024u} * 1024u, true}};
+    const auto element{hashed.load<Helper::BaseElement>(xmlFileName, "BaseElement")};
+    std::filesystem::remove(xmlFileName);
+
+    ASSERT_TRUE(element);
+    EXPECT_EQ("Marked", element->text);
+}
+
+TEST(HashTest, HashBytes)
+{
+    EXPECT_EQ(FileParse::hashBytes("Some text to hash"), FileParse::hashBytes("Some text to hash"));
+    EXPECT_NE(FileParse::hashBytes("Some text to hash"), FileParse::hashBytes("Some text to hasH"));
+    EXPECT_NE(FileParse::hashBytes("abcdefgh"), FileParse::hashBytes("abcdefgh1"));
+    EXPECT_NE(FileParse::hashBytes(""), FileParse::hashBytes(std::string_view("\0", 1)));
+}
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include "include/fileParse/Vector.hxx"
+#include "include/fileParse/Array.hxx"
+#include "include/fileParse/FileDataHandler.hxx"
+
+#include "test/helper/Utility.hxx"
+#include "test/helper/MockNodeAdapter.hxx"
+
+class PackedSerializerTest : public testing::Test
+{
+protected:
+    static constexpr auto tolerance{1e-6};
+};
+
+TEST_F(PackedSerializerTest, SerializeVectorOfDoubles)
+{
+    const std::vector<double> values{38.8048, 25.5758, 96.1831, 90.3927};
+
+    Helper::MockNode elementNode("Root");
+    Helper::MockNodeAdapter adapter{&elementNode};
+    adapter << FileParse::Packed{{"Table", "Values"}, values};
+
+    auto correctNodes = []() {
+        Helper::MockNode node{"Root"};
+        auto & child{Helper::addChildNode(node, "Table")};
+        addChildNode(child, "Values", "38.8048 25.5758 96.1831 90.3927");
+
+        return node;
+    };
+
+    EXPECT_TRUE(Helper::compareNodes(adapter.getNode(), correctNodes()));
+}
+
+TEST_F(PackedSerializerTest, DeserializeVectorOfDoubles)
+{
+    Helper::MockNode elementNode{"Root"};
+    auto & child{Helper::addChildNode(elementNode, "Table")};
+    addChildNode(child, "Values", "  38.8048\n25.5758\t96.1831, 1e-5  ");
+    const Helper::MockNodeAdapter adapter{&elementNode};
+
+    std::vector<double> values{1.0};
+    adapter >> FileParse::Packed{{"Table", "Values"}, values};
+
+    Helper::checkVectorValues({38.8048, 25.5758, 96.1831, 1e-5}, values, tolerance);
+}
+
+TEST_F(PackedSerializerTest, DeserializeMissingNode)
+{
+    Helper::MockNode elementNode{"Root"};
+    const Helper::MockNodeAdapter adapter{&elementNode};
+
+    std::vector<double> values{1.0, 2.0};
+    adapter >> FileParse::Packed{"Values", values};
+
+    EXPECT_TRUE(values.empty());
+}
+
+TEST_F(PackedSerializerTest, DeserializeInvalidValueThrows)
+{
+    Helper::MockNode elementNode{"Root"};
+    addChildNode(elementNode, "Values", "1.5 abc");
+    const Helper::MockNodeAdapter adapter{&elementNode};
+
+    std::vector<double> values;
+    EXPECT_THROW((adapter >> FileParse::Packed{"Values", values}), std::invalid_argument);
+}
+
+TEST_F(PackedSerializerTest, ArrayOfDoublesRoundTrip)
+{
+    const std::array<double, 4> values{38.8048, 25.5758, 96.1831, 90.3927};
+
+    Helper::MockNode elementNode("Root");
+    Helper::MockNodeAdapter adapter{&elementNode};
+    adapter << FileParse::Packed{"Values", values};
+
+    std::array<double, 4> loaded{0, 0, 0, 0};
+    adapter >> FileParse::Packed{"Values", loaded};
+
+    Helper::checkArrayValues(values, loaded, tolerance);
+}
+
+TEST_F(PackedSerializerTest, ArrayOfDoublesIncomplete)
+{
+    Helper::MockNode elementNode{"Root"};
+    addChildNode(elementNode, "Values", "38.8048 25.5758");
+    const Helper::MockNodeAdapter adapter{&elementNode};
+
+    std::array<double, 4> loaded{0, 0, 0, 0};
+    adapter >> FileParse::Packed{"Values", loaded};
+
+    Helper::checkArrayValues({38.8048, 25.5758, 0, 0}, loaded, tolerance);
+}
+
+TEST_F(PackedSerializerTest, XMLStringRoundTrip)
+{
+    const std::vector<double> values{0.3, 0.31, 1e-7, 250000.0};
+
+    auto node = createXMLTopNode("Spectrum");
+    node << FileParse::Packed{"Wavelengths", values};
+
+    const auto xmlNode = getXMLTopNodeFromString(node.getContent(), "Spectrum");
+    ASSERT_TRUE(xmlNode.has_value());
+    EXPECT_EQ(1, xmlNode->nChildNode("Wavelengths"));
+
+    std::vector<double> loaded;
+    xmlNode.value() >> FileParse::Packed{"Wavelengths", loaded};
+
+    Helper::checkVectorValues(values, loaded, tolerance);
+}
+
+TEST_F(PackedSerializerTest, JSONNativeNumberArray)
+{
+    const std::vector<int> values{1, -2, 3};
+
+    auto node = createJSONTopNode("Counts");
+    node << FileParse::Packed{"Values", values};
+
+    const auto content{node.getContent()};
+    EXPECT_NE(std::string::npos, content.find("-2")) << content;
+    EXPECT_EQ(std::string::npos, content.find("\"1\"")) << content;
+
+    const auto jsonNode = getJSONTopNodeFromString(content, "Counts");
+    ASSERT_TRUE(jsonNode.has_value());
+
+    std::vector<int> loaded;
+    jsonNode.value() >> FileParse::Packed{"Values", loaded};
+
+    Helper::checkVectorEquality(values, loaded);
+}
+
+TEST_F(PackedSerializerTest, JSONReadsHandWrittenArray)
+{
+    const auto jsonNode
+      = getJSONTopNodeFromString(R"({"Spectrum": {"Wavelengths": [0.3, 0.31, 2]}})", "Spectrum");
+    ASSERT_TRUE(jsonNode.has_value());
+
+    std::vector<double> loaded;
+    jsonNode.value() >> FileParse::Packed{"Wavelengths", loaded};
+
+    Helper::checkVectorValues({0.3, 0.31, 2.0}, loaded, tolerance);
+}
+
+TEST_F(PackedSerializerTest, JSONUnsignedBeyondSignedRange)
+{
+    const std::vector<uint64_t> values{0u, 9223372036854775808u, 18446744073709551615u};
+
+    auto node = createJSONTopNode("Counts");
+    node << FileParse::Packed{"Values", values};
+
+    const auto jsonNode = getJSONTopNodeFromString(node.getContent(), "Counts");
+    ASSERT_TRUE(jsonNode.has_value());
+
+    std::vector<uint64_t> loaded;
+    jsonNode.value() >> FileParse::Packed{"Values", loaded};
+
+    EXPECT_EQ(values, loaded);
+}
+
+TEST_F(PackedSerializerTest, JSONRejectsMalformedAndNonFiniteValues)
+{
+    auto node = createJSONTopNode("Values");
+    for(const auto * values : {"1 1.5abc", "1 inf", "nan", "+-2", "0x10"})
+    {
+        EXPECT_THROW(node.addPackedValues("Values", values), std::invalid_argument) << values;
+    }
+    EXPECT_THROW(node.addPackedValues("Values", "1e999"), std::out_of_range);
+
+    node.addPackedValues("Values", "+1 -2 2.5e-1");
+    EXPECT_EQ("1 -2 0.25", node.getPackedValues("Values"));
+}
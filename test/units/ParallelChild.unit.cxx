@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include "include/fileParse/Vector.hxx"
+#include "include/fileParse/FileDataHandler.hxx"
+
+#include "test/helper/Utility.hxx"
+#include "test/helper/MockNodeAdapter.hxx"
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+class ParallelChildTest : public testing::Test
+{
+protected:
+    static constexpr size_t recordCount{1000u};
+
+    static std::vector<double> createValues()
+    {
+        std::vector<double> values;
+        for(size_t i = 0u; i < recordCount; ++i)
+        {
+            values.push_back(static_cast<double>(i) + 0.25);
+        }
+        return values;
+    }
+};
+
+TEST_F(ParallelChildTest, DeserializeDoublesXML)
+{
+    const auto values{createValues()};
+
+    auto node = createXMLTopNode("Root");
+    node << FileParse::Child{{"Table", "Value"}, values};
+
+    const auto xmlNode = getXMLTopNodeFromString(node.getContent(), "Root");
+    ASSERT_TRUE(xmlNode.has_value());
+
+    std::vector<double> loaded{1.0};
+    xmlNode.value() >> FileParse::ParallelChild{{"Table", "Value"}, loaded, 4u};
+
+    Helper::checkVectorValues(values, loaded, 1e-6);
+}
+
+TEST_F(ParallelChildTest, DeserializeRecordsJSON)
+{
+    std::vector<Helper::BaseElement> records(recordCount);
+    for(size_t i = 0u; i < recordCount; ++i)
+    {
+        records[i].text = "Record" + std::to_string(i);
+        records[i].integer_number = static_cast<int>(i);
+    }
+
+    auto node = createJSONTopNode("Root");
+    node << FileParse::ParallelChild{"BaseElement", std::as_const(records)};
+
+    const auto jsonNode = getJSONTopNodeFromString(node.getContent(), "Root");
+    ASSERT_TRUE(jsonNode.has_value());
+
+    std::vector<Helper::BaseElement> loaded;
+    jsonNode.value() >> FileParse::ParallelChild{"BaseElement", loaded, 8u};
+
+    ASSERT_EQ(recordCount, loaded.size());
+    for(size_t i = 0u; i < recordCount; ++i)
+    {
+        EXPECT_EQ(records[i].text, loaded[i].text);
+        EXPECT_EQ(records[i].integer_number, loaded[i].integer_number);
+    }
+}
+
+TEST_F(ParallelChildTest, DeserializeRecordsXML)
+{
+    std::vector<Helper::BaseElement> records(recordCount);
+    for(size_t i = 0u; i < recordCount; ++i)
+    {
+        records[i].text = "Record" + std::to_string(i);
+        records[i].integer_number = static_cast<int>(i);
+    }
+
+    auto node = createXMLTopNode("Root");
+    node << FileParse::Child{"BaseElement", std::as_const(records)};
+
+    const auto xmlNode = getXMLTopNodeFromString(node.getContent(), "Root");
+    ASSERT_TRUE(xmlNode.has_value());
+
+    std::vector<Helper::BaseElement> loaded;
+    xmlNode.value() >> FileParse::ParallelChild{"BaseElement", loaded, 8u};
+
+    ASSERT_EQ(recordCount, loaded.size());
+    for(size_t i = 0u; i < recordCount; ++i)
+    {
+        EXPECT_EQ(records[i].text, loaded[i].text);
+        EXPECT_EQ(records[i].integer_number, loaded[i].integer_number);
+    }
+}
+
+TEST_F(ParallelChildTest, DeserializeMissingNode)
+{
+    Helper::MockNode elementNode{"Root"};
+    const Helper::MockNodeAdapter adapter{&elementNode};
+
+    std::vector<double> loaded{1.0, 2.0};
+    adapter >> FileParse::ParallelChild{{"Table", "Value"}, loaded};
+
+    EXPECT_TRUE(loaded.empty());
+}
+
+TEST_F(ParallelChildTest, InvalidElementThrows)
+{
+    Helper::MockNode elementNode{"Root"};
+    auto & child{Helper::addChildNode(elementNode, "Table")};
+    for(size_t i = 0u; i < 100u; ++i)
+    {
+        addChildNode(child, "Value", i == 57u ? "abc" : "1.5");
+    }
+    const Helper::MockNodeAdapter adapter{&elementNode};
+
+    std::vector<double> loaded;
+    EXPECT_THROW((adapter >> FileParse::ParallelChild{{"Table", "Value"}, loaded, 4u}),
+                 std::invalid_argument);
+}
+
+TEST_F(ParallelChildTest, SerializeRecordsXMLMatchesChild)
+{
+    std::vector<Helper::BaseElement> records(recordCount);
+    for(size_t i = 0u; i < recordCount; ++i)
+    {
+        records[i].text = "Record" + std::to_string(i);
+        records[i].integer_number = static_cast<int>(i);
+    }
+
+    auto sequential = createXMLTopNode("Root");
+    sequential << FileParse::Child{{"Table", "BaseElement"}, std::as_const(records)};
+
+    auto parallel = createXMLTopNode("Root");
+    parallel << FileParse::ParallelChild{{"Table", "BaseElement"}, std::as_const(records), 8u};
+
+    EXPECT_EQ(sequential.getContent(), parallel.getContent());
+}
+
+TEST_F(ParallelChildTest, SerializeDoublesJSONMatchesChild)
+{
+    const auto values{createValues()};
+
+    auto sequential = createJSONTopNode("Root");
+    sequential << FileParse::Child{{"Table", "Value"}, values};
+
+    auto parallel = createJSONTopNode("Root");
+    parallel << FileParse::ParallelChild{{"Table", "Value"}, values, 4u};
+
+    EXPECT_EQ(sequential.getContent(), parallel.getContent());
+}
+
+TEST_F(ParallelChildTest, SerializeSingleElementJSON)
+{
+    const std::vector<std::string> values{"Only"};
+
+    auto sequential = createJSONTopNode("Root");
+    sequential << FileParse::Child{"Value", values};
+
+    auto parallel = createJSONTopNode("Root");
+    parallel << FileParse::ParallelChild{"Value", values};
+
+    EXPECT_EQ(sequential.getContent(), parallel.getContent());
+}
+
+TEST_F(ParallelChildTest, SerializeMock)
+{
+    const std::vector<int> values{3, 1, 4, 1, 5, 9, 2, 6};
+
+    // The mock adapter has no detached nodes, so the elements are serialized on this thread
+    Helper::MockNode elementNode{"Root"};
+    Helper::MockNodeAdapter adapter{&elementNode};
+    ASSERT_FALSE(adapter.supportsDetachedNodes());
+    EXPECT_THROW(static_cast<void>(adapter.createDetachedNode("Value")), std::logic_error);
+    adapter << FileParse::ParallelChild{{"Table", "Value"}, values, 3u};
+
+    Helper::MockNode expected{"Root"};
+    auto & table{Helper::addChildNode(expected, "Table")};
+    for(const auto value : values)
+    {
+        Helper::addChildNode(table, "Value", std::to_string(value));
+    }
+
+    EXPECT_TRUE(Helper::compareNodes(elementNode, expected));
+}
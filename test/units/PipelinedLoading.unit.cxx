@@ -0,0 +1,172 @@
+/// Pipelined loading where reading the file overlaps with parsing (XML and JSON)
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/FileDataHandler.hxx"
+#include "include/fileParse/Vector.hxx"
+
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+class PipelinedLoadingTest : public testing::Test
+{
+protected:
+    // Tiny chunks so that every document spans many of them
+    static constexpr FileParse::PipelineOptions smallChunks{7u, 2u};
+
+    static std::string dataFile(const std::string & name)
+    {
+        return (std::filesystem::path{TEST_DATA_DIR} / name).string();
+    }
+
+    static std::string readWholeFile(const std::string & fileName)
+    {
+        std::ifstream file{fileName, std::ios::binary};
+        std::ostringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    static void verifyBaseElement(const std::optional<Helper::BaseElement> & element)
+    {
+        ASSERT_TRUE(element.has_value());
+        EXPECT_EQ("TestText", element->text);
+        EXPECT_EQ(13, element->integer_number);
+        EXPECT_NEAR(3.1415926, element->double_number, 1e-6);
+        EXPECT_EQ("OptionalText", element->optional_text);
+    }
+};
+
+TEST_F(PipelinedLoadingTest, BoundedQueueKeepsOrder)
+{
+    FileParse::BoundedQueue<int> queue{3u};
+
+    std::thread producer([&]() {
+        for(int i = 0; i < 1000; ++i)
+        {
+            queue.push(i);
+        }
+        queue.close();
+    });
+
+    int expected{0};
+    while(const auto item{queue.pop()})
+    {
+        EXPECT_EQ(expected++, item.value());
+    }
+    producer.join();
+
+    EXPECT_EQ(1000, expected);
+    EXPECT_FALSE(queue.push(1000));
+}
+
+TEST_F(PipelinedLoadingTest, ReaderReassemblesFile)
+{
+    const auto fileName{dataFile("BaseElement.json")};
+
+    FileParse::PipelinedFileReader reader{fileName, smallChunks};
+    ASSERT_TRUE(reader.isOpen());
+
+    std::string content;
+    reader.readRemaining(content);
+    EXPECT_EQ(readWholeFile(fileName), content);
+    EXPECT_FALSE(reader.nextChunk().has_value());
+    EXPECT_FALSE(reader.failed());
+}
+
+TEST_F(PipelinedLoadingTest, ReadErrorFailsTheLoad)
+{
+    // Opening a directory succeeds, but reading it fails
+    const auto directory{(std::filesystem::temp_directory_path() / "PipelinedDirectory.json")};
+    std::filesystem::create_directories(directory);
+
+    FileParse::PipelinedFileReader reader{directory.string(), smallChunks};
+    if(reader.isOpen())
+    {
+        EXPECT_FALSE(reader.nextChunk().has_value());
+        EXPECT_TRUE(reader.failed());
+    }
+    EXPECT_FALSE(Common::getTopNodeFromFilePipelined(directory.string(), "Root").has_value());
+
+    std::filesystem::remove(directory);
+}
+
+TEST_F(PipelinedLoadingTest, ReaderStopsWhenDestroyedEarly)
+{
+    FileParse::PipelinedFileReader reader{dataFile("BaseElement.xml"), {1u, 1u}};
+    ASSERT_TRUE(reader.nextChunk().has_value());
+    // The destructor must not wait for the remaining chunks to be consumed
+}
+
+TEST_F(PipelinedLoadingTest, LoadXML)
+{
+    verifyBaseElement(Common::loadFromFilePipelined<Helper::BaseElement>(
+      dataFile("BaseElement.xml"), "BaseElement", smallChunks));
+}
+
+TEST_F(PipelinedLoadingTest, LoadJSON)
+{
+    verifyBaseElement(Common::loadFromFilePipelined<Helper::BaseElement>(
+      dataFile("BaseElement.json"), "BaseElement", smallChunks));
+}
+
+TEST_F(PipelinedLoadingTest, LoadLargeJSONWithDefaultOptions)
+{
+    std::vector<double> values;
+    for(size_t i = 0u; i < 100000u; ++i)
+    {
+        values.push_back(static_cast<double>(i) * 0.5);
+    }
+
+    const auto fileName{
+      (std::filesystem::temp_directory_path() / "PipelinedLargeValues.json").string()};
+    auto node{createJSONTopNode("Root")};
+    node << FileParse::Child{{"Table", "Value"}, std::as_const(values)};
+    ASSERT_EQ(0, node.writeToFile(fileName));
+
+    const auto loaded{Common::getTopNodeFromFilePipelined(fileName, "Root")};
+    ASSERT_TRUE(loaded.has_value());
+
+    std::vector<double> result;
+    std::get<JSONNodeAdapter>(loaded.value()) >> FileParse::Child{{"Table", "Value"}, result};
+    EXPECT_EQ(values, result);
+
+    std::filesystem::remove(fileName);
+}
+
+TEST_F(PipelinedLoadingTest, LoadWithByteOrderMark)
+{
+    for(const std::string extension : {".xml", ".json"})
+    {
+        const auto fileName{
+          (std::filesystem::temp_directory_path() / ("PipelinedByteOrderMark" + extension))
+            .string()};
+        {
+            std::ofstream file{fileName, std::ios::binary};
+            file << "\xEF\xBB\xBF" << readWholeFile(dataFile("BaseElement" + extension));
+        }
+
+        verifyBaseElement(Common::loadFromFilePipelined<Helper::BaseElement>(
+          fileName, "BaseElement", {1u, 2u}));
+
+        std::filesystem::remove(fileName);
+    }
+}
+
+TEST_F(PipelinedLoadingTest, MissingFileIsNotCreated)
+{
+    const auto fileName{dataFile("DoesNotExist.json")};
+
+    EXPECT_FALSE(
+      Common::loadFromFilePipelined<Helper::BaseElement>(fileName, "BaseElement").has_value());
+    EXPECT_FALSE(std::filesystem::exists(fileName));
+}
+
+TEST_F(PipelinedLoadingTest, WrongRootReturnsNullopt)
+{
+    EXPECT_FALSE(Common::loadFromFilePipelined<Helper::BaseElement>(
+                   dataFile("BaseElement.xml"), "Missing", smallChunks)
+                   .has_value());
+}
@@ -0,0 +1,142 @@
+/// Decoding into containers with custom allocators, such as the std::pmr containers
+#include <array>
+#include <map>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/Arena.hxx"
+#include "include/fileParse/Map.hxx"
+#include "include/fileParse/Set.hxx"
+#include "include/fileParse/Vector.hxx"
+
+#include "test/helper/MockNodeAdapter.hxx"
+#include "test/helper/Utility.hxx"
+
+static_assert(FileParse::is_valid_map<std::pmr::map<std::pmr::string, double>>::value);
+static_assert(FileParse::is_valid_map<std::pmr::unordered_map<std::string, int>>::value);
+
+class PmrContainersTest : public testing::Test
+{
+protected:
+    // Values are longer than the small string buffer, so every string allocates
+    static Helper::MockNode createTable()
+    {
+        Helper::MockNode node{"Root"};
+        auto & tableNode{Helper::addChildNode(node, "Table")};
+        addChildNode(tableNode, "Value", "A value that does not fit into the string");
+        addChildNode(tableNode, "Value", "Another value that does not fit into it");
+
+        return node;
+    }
+
+    // Anything allocated outside of the buffer would throw std::bad_alloc
+    std::array<std::byte, 4096> buffer{};
+    std::pmr::monotonic_buffer_resource arena{
+      buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+};
+
+TEST_F(PmrContainersTest, DeserializeVectorOfStrings)
+{
+    auto elementNode{createTable()};
+    const Helper::MockNodeAdapter adapter{&elementNode};
+
+    std::pmr::vector<std::pmr::string> values{&arena};
+    adapter >> FileParse::Child{{"Table", "Value"}, values};
+
+    ASSERT_EQ(2u, values.size());
+    EXPECT_EQ("A value that does not fit into the string", values[0]);
+    EXPECT_EQ("Another value that does not fit into it", values[1]);
+    for(const auto & value : values)
+    {
+        EXPECT_EQ(&arena, value.get_allocator().resource());
+    }
+}
+
+TEST_F(PmrContainersTest, DeserializeSetOfStrings)
+{
+    auto elementNode{createTable()};
+    const Helper::MockNodeAdapter adapter{&elementNode};
+
+    std::pmr::set<std::pmr::string> values{&arena};
+    adapter >> FileParse::Child{{"Table", "Value"}, values};
+
+    ASSERT_EQ(2u, values.size());
+    EXPECT_EQ(1u, values.count("A value that does not fit into the string"));
+    for(const auto & value : values)
+    {
+        EXPECT_EQ(&arena, value.get_allocator().resource());
+    }
+}
+
+TEST_F(PmrContainersTest, DeserializeMapOfStrings)
+{
+    Helper::MockNode elementNode{"Root"};
+    auto & mapNode{Helper::addChildNode(elementNode, "Map")};
+    addChildNode(mapNode, "AKeyThatDoesNotFitIntoTheString", "A value that does not fit into it");
+    addChildNode(mapNode, "Short", "Value");
+    const Helper::MockNodeAdapter adapter{&elementNode};
+
+    std::pmr::map<std::pmr::string, std::pmr::string> values{&arena};
+    adapter >> FileParse::Child{"Map", values};
+
+    ASSERT_EQ(2u, values.size());
+    EXPECT_EQ("A value that does not fit into it", values.at("AKeyThatDoesNotFitIntoTheString"));
+    EXPECT_EQ("Value", values.at("Short"));
+    for(const auto & [key, value] : values)
+    {
+        EXPECT_EQ(&arena, key.get_allocator().resource());
+        EXPECT_EQ(&arena, value.get_allocator().resource());
+    }
+}
+
+TEST_F(PmrContainersTest, DeserializePackedValues)
+{
+    Helper::MockNode elementNode{"Root"};
+    addChildNode(elementNode, "Values", "1.5 2.5 3.5");
+    const Helper::MockNodeAdapter adapter{&elementNode};
+
+    std::pmr::vector<double> values{&arena};
+    adapter >> FileParse::Packed{"Values", values};
+
+    Helper::checkVectorValues({1.5, 2.5, 3.5}, {values.begin(), values.end()}, 1e-6);
+    EXPECT_EQ(&arena, values.get_allocator().resource());
+}
+
+TEST_F(PmrContainersTest, SerializeMatchesDefaultAllocator)
+{
+    const std::pmr::vector<std::pmr::string> pmrValues{{"First", "Second"}, &arena};
+    const std::pmr::map<std::pmr::string, double> pmrMap{{{"Key", 1.5}}, &arena};
+    const std::vector<std::string> values{"First", "Second"};
+    const std::map<std::string, double> map{{"Key", 1.5}};
+
+    Helper::MockNode pmrNode{"Root"};
+    Helper::MockNodeAdapter pmrAdapter{&pmrNode};
+    pmrAdapter << FileParse::Child{{"Table", "Value"}, pmrValues};
+    pmrAdapter << FileParse::Child{"Map", pmrMap};
+
+    Helper::MockNode node{"Root"};
+    Helper::MockNodeAdapter adapter{&node};
+    adapter << FileParse::Child{{"Table", "Value"}, values};
+    adapter << FileParse::Child{"Map", map};
+
+    EXPECT_TRUE(Helper::compareNodes(pmrAdapter.getNode(), adapter.getNode()));
+}
+
+TEST_F(PmrContainersTest, CustomAllocator)
+{
+    auto elementNode{createTable()};
+    const Helper::MockNodeAdapter adapter{&elementNode};
+
+    std::vector<std::string, FileParse::ArenaAllocator<std::string>> values;
+    {
+        FileParse::ScopedArena scope{&arena};
+        adapter >> FileParse::Child{{"Table", "Value"}, values};
+    }
+
+    ASSERT_EQ(2u, values.size());
+    EXPECT_EQ("Another value that does not fit into it", values[1]);
+}
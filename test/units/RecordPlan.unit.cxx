@@ -0,0 +1,134 @@
+/// Single pass decoding of records through per-type plans (XML and JSON)
+#include <array>
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/Array.hxx"
+#include "include/fileParse/Fields.hxx"
+#include "include/fileParse/FileDataHandler.hxx"
+#include "include/fileParse/Optional.hxx"
+#include "include/fileParse/Set.hxx"
+#include "include/fileParse/Vector.hxx"
+
+namespace RecordPlanTest
+{
+    struct Record
+    {
+        std::string name;
+        int count{0};
+        std::vector<double> values;
+        std::set<int> ids;
+        std::optional<std::vector<std::string>> notes;
+        std::optional<double> factor;
+        std::vector<double> inner;
+        std::string alias;
+        std::array<int, 2> pair{};
+    };
+
+    // Fields registered by hand, including ones that the plan leaves to Child
+    constexpr auto fileParseFields(const Record *)
+    {
+        using FileParse::field;
+        return std::make_tuple(field("Name", &Record::name),
+                               field("Count", &Record::count),
+                               field("Value", &Record::values),
+                               field("Id", &Record::ids),
+                               field("Note", &Record::notes),
+                               field("Factor", &Record::factor),
+                               field({"Outer", "Inner"}, &Record::inner),
+                               field("Name", &Record::alias),
+                               field("Pair", &Record::pair));
+    }
+
+    template<typename NodeAdapter>
+    void decodeByChild(const NodeAdapter & node, Record & record)
+    {
+        using FileParse::Child;
+        node >> Child{"Name", record.name};
+        node >> Child{"Count", record.count};
+        node >> Child{"Value", record.values};
+        node >> Child{"Id", record.ids};
+        node >> Child{"Note", record.notes};
+        node >> Child{"Factor", record.factor};
+        node >> Child{{"Outer", "Inner"}, record.inner};
+        node >> Child{"Name", record.alias};
+        node >> Child{"Pair", record.pair};
+    }
+
+    Record createFilledRecord()
+    {
+        Record record;
+        record.values = {9.0};
+        record.ids = {9};
+        return record;
+    }
+
+    void expectEqual(const Record & expected, const Record & record)
+    {
+        EXPECT_EQ(expected.name, record.name);
+        EXPECT_EQ(expected.count, record.count);
+        EXPECT_EQ(expected.values, record.values);
+        EXPECT_EQ(expected.ids, record.ids);
+        EXPECT_EQ(expected.notes, record.notes);
+        EXPECT_EQ(expected.factor, record.factor);
+        EXPECT_EQ(expected.inner, record.inner);
+        EXPECT_EQ(expected.alias, record.alias);
+        EXPECT_EQ(expected.pair, record.pair);
+    }
+}   // namespace RecordPlanTest
+
+TEST(RecordPlanTest, FieldIndex)
+{
+    const auto & plan{FileParse::recordPlan<RecordPlanTest::Record>()};
+
+    EXPECT_EQ(0u, plan.fieldIndex("Name"));
+    EXPECT_EQ(2u, plan.fieldIndex("Value"));
+    EXPECT_FALSE(plan.fieldIndex("Outer").has_value());
+    EXPECT_FALSE(plan.fieldIndex("Pair").has_value());
+    EXPECT_FALSE(plan.fieldIndex("Unknown").has_value());
+}
+
+TEST(RecordPlanTest, MatchesChildDecodingXML)
+{
+    const std::string xml{"<Record>"
+                          "<Value>1.5</Value><Name>First</Name><Id>3</Id><Count>4</Count>"
+                          "<Value>2.5</Value><Name>Second</Name><Id>1</Id>"
+                          "<Outer><Inner>7.5</Inner><Inner>8.5</Inner></Outer>"
+                          "<Pair>1</Pair><Pair>2</Pair><Pair>3</Pair><Unknown>x</Unknown>"
+                          "</Record>"};
+    const auto node{getXMLTopNodeFromString(xml, "Record")};
+    ASSERT_TRUE(node.has_value());
+
+    auto expected{RecordPlanTest::createFilledRecord()};
+    RecordPlanTest::decodeByChild(node.value(), expected);
+    EXPECT_EQ("First", expected.name);
+    EXPECT_EQ((std::vector<double>{1.5, 2.5}), expected.values);
+    EXPECT_EQ((std::vector<double>{7.5, 8.5}), expected.inner);
+    EXPECT_FALSE(expected.notes.has_value());
+
+    auto record{RecordPlanTest::createFilledRecord()};
+    FileParse::recordPlan<RecordPlanTest::Record>().decode(node.value(), record);
+    RecordPlanTest::expectEqual(expected, record);
+}
+
+TEST(RecordPlanTest, MatchesChildDecodingJSON)
+{
+    const std::string json{R"({"Record": {"Name": "First", "Count": 4, "Value": [1.5, 2.5],
+                                          "Note": ["a", "b"], "Factor": 0.5,
+                                          "Outer": {"Inner": [7.5, 8.5]}, "Pair": [5, 6]}})"};
+    const auto node{getJSONTopNodeFromString(json, "Record")};
+    ASSERT_TRUE(node.has_value());
+
+    auto expected{RecordPlanTest::createFilledRecord()};
+    RecordPlanTest::decodeByChild(node.value(), expected);
+    EXPECT_EQ((std::vector<std::string>{"a", "b"}), expected.notes);
+    EXPECT_TRUE(expected.ids.empty());
+
+    auto record{RecordPlanTest::createFilledRecord()};
+    FileParse::recordPlan<RecordPlanTest::Record>().decode(node.value(), record);
+    RecordPlanTest::expectEqual(expected, record);
+}
@@ -0,0 +1,93 @@
+/// Saving with options, skipping files whose content would not change (XML and JSON)
+#include <filesystem>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/FileDataHandler.hxx"
+
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+class SaveOptionsTest : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        for(const auto & file : tempFiles)
+        {
+            std::filesystem::remove(file);
+        }
+    }
+
+    std::string addTempFile(const std::string & name)
+    {
+        const auto fileName{(std::filesystem::temp_directory_path() / name).string()};
+        tempFiles.push_back(fileName);
+        return fileName;
+    }
+
+    static Helper::BaseElement createElement(const std::string & text)
+    {
+        Helper::BaseElement element;
+        element.text = text;
+        element.integer_number = 7;
+        return element;
+    }
+
+    // Saves twice with the same content and once with changed content
+    void checkSkipUnchanged(const std::string & fileName) const
+    {
+        const Common::SaveOptions options{true};
+
+        const auto first{Common::saveToFile(createElement("Text"), fileName, "Root", options)};
+        EXPECT_EQ(0, first.status);
+        EXPECT_TRUE(first.written);
+
+        // Move the modification time back, so a rewrite would be visible
+        const auto past{std::filesystem::last_write_time(fileName) - std::chrono::hours(1)};
+        std::filesystem::last_write_time(fileName, past);
+
+        const auto second{Common::saveToFile(createElement("Text"), fileName, "Root", options)};
+        EXPECT_EQ(0, second.status);
+        EXPECT_FALSE(second.written);
+        EXPECT_EQ(past, std::filesystem::last_write_time(fileName));
+
+        const auto third{Common::saveToFile(createElement("Txet"), fileName, "Root", options)};
+        EXPECT_EQ(0, third.status);
+        EXPECT_TRUE(third.written);
+
+        const auto loaded{Common::loadFromFile<Helper::BaseElement>(fileName, "Root")};
+        ASSERT_TRUE(loaded.has_value());
+        EXPECT_EQ("Txet", loaded->text);
+        EXPECT_EQ(7, loaded->integer_number);
+    }
+
+    std::vector<std::string> tempFiles;
+};
+
+TEST_F(SaveOptionsTest, SkipUnchangedXML)
+{
+    checkSkipUnchanged(addTempFile("SaveOptionsTest.xml"));
+}
+
+TEST_F(SaveOptionsTest, SkipUnchangedJSON)
+{
+    checkSkipUnchanged(addTempFile("SaveOptionsTest.json"));
+}
+
+TEST_F(SaveOptionsTest, WritesWithoutSkipping)
+{
+    const auto fileName{addTempFile("SaveOptionsAlways.json")};
+    const auto element{createElement("Text")};
+
+    EXPECT_TRUE(Common::saveToJSONFile(element, fileName, "Root", {}).written);
+    EXPECT_TRUE(Common::saveToJSONFile(element, fileName, "Root", {}).written);
+}
+
+TEST_F(SaveOptionsTest, UnknownExtension)
+{
+    const auto result{
+      Common::saveToFile(createElement("Text"), "SaveOptions.txt", "Root", {true})};
+
+    EXPECT_EQ(-1, result.status);
+    EXPECT_FALSE(result.written);
+}
@@ -0,0 +1,145 @@
+/// Work-stealing scheduler, pluggable executors and parallel loops running on them
+#include <filesystem>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/FileDataHandler.hxx"
+#include "include/fileParse/Vector.hxx"
+
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+namespace
+{
+    // Executor that runs every task on a new thread and counts the tasks it received
+    class CountingExecutor : public FileParse::Executor
+    {
+    public:
+        ~CountingExecutor() override
+        {
+            for(auto & thread : threads_)
+            {
+                thread.join();
+            }
+        }
+
+        void execute(std::function<void()> task) override
+        {
+            ++tasks;
+            std::scoped_lock lock{mutex_};
+            threads_.emplace_back(std::move(task));
+        }
+
+        [[nodiscard]] size_t concurrency() const override
+        {
+            return 3u;
+        }
+
+        std::atomic<size_t> tasks{0u};
+
+    private:
+        std::mutex mutex_;
+        std::vector<std::thread> threads_;
+    };
+}   // namespace
+
+class SchedulerTest : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        FileParse::setDefaultExecutor(nullptr);
+    }
+
+    static std::vector<std::string> createValues()
+    {
+        std::vector<std::string> values;
+        for(size_t i = 0u; i < 500u; ++i)
+        {
+            values.push_back(std::to_string(i));
+        }
+        return values;
+    }
+
+    template<typename NodeAdapter>
+    static void checkForEachChild(NodeAdapter node)
+    {
+        const auto values{createValues()};
+        node << FileParse::Child{"Value", values};
+
+        std::vector<std::string> visited(values.size());
+        FileParse::parallelForEachChild(node, "Value", [&](const auto & child, size_t index) {
+            visited[index] = child.getText();
+        });
+
+        EXPECT_EQ(values, visited);
+    }
+};
+
+TEST_F(SchedulerTest, RunsAllTasks)
+{
+    FileParse::WorkStealingScheduler scheduler{4u};
+    EXPECT_EQ(4u, scheduler.concurrency());
+
+    std::vector<int> results(10000u, 0);
+    FileParse::parallelFor(scheduler, results.size(), 0u, [&](size_t index) {
+        results[index] = static_cast<int>(index) * 2;
+    });
+
+    for(size_t i = 0u; i < results.size(); ++i)
+    {
+        EXPECT_EQ(static_cast<int>(i) * 2, results[i]);
+    }
+}
+
+TEST_F(SchedulerTest, NestedLoopsDoNotDeadlock)
+{
+    FileParse::WorkStealingScheduler scheduler{2u};
+
+    std::atomic<size_t> calls{0u};
+    FileParse::parallelFor(scheduler, 16u, 0u, [&](size_t) {
+        FileParse::parallelFor(scheduler, 100u, 0u, [&](size_t) { ++calls; });
+    });
+
+    EXPECT_EQ(1600u, calls);
+}
+
+TEST_F(SchedulerTest, ExternalExecutor)
+{
+    CountingExecutor executor;
+
+    std::atomic<size_t> calls{0u};
+    FileParse::parallelFor(executor, 100u, 0u, [&](size_t) { ++calls; });
+
+    EXPECT_EQ(100u, calls);
+    EXPECT_EQ(3u, executor.tasks);
+}
+
+TEST_F(SchedulerTest, ReplaceDefaultExecutor)
+{
+    auto executor{std::make_shared<CountingExecutor>()};
+    FileParse::setDefaultExecutor(executor);
+    EXPECT_EQ(executor, FileParse::defaultExecutor());
+
+    const std::filesystem::path productPath{TEST_DATA_DIR};
+    const std::vector<std::filesystem::path> files(8u, productPath / "BaseElement.xml");
+    const auto results{Common::loadManyFromFiles<Helper::BaseElement>(files, "BaseElement")};
+
+    EXPECT_EQ(3u, executor->tasks);
+    for(const auto & result : results)
+    {
+        EXPECT_TRUE(result.value.has_value()) << result.error;
+    }
+
+    FileParse::setDefaultExecutor(nullptr);
+    EXPECT_NE(executor, FileParse::defaultExecutor());
+}
+
+TEST_F(SchedulerTest, ForEachChildXML)
+{
+    checkForEachChild(createXMLTopNode("Root"));
+}
+
+TEST_F(SchedulerTest, ForEachChildJSON)
+{
+    checkForEachChild(createJSONTopNode("Root"));
+}
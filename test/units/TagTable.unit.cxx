@@ -0,0 +1,110 @@
+/// Interning of tag names
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/TagTable.hxx"
+#include "include/fileParse/JSONNodeAdapter.hxx"
+
+TEST(TagTableTest, EqualNamesShareStorage)
+{
+    const std::string name{"TagTableTestLayer"};
+    const FileParse::Tag first{name};
+    const FileParse::Tag second{std::string_view{"TagTableTestLayer"}};
+    const FileParse::Tag other{"TagTableTestValue"};
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first.view().data(), second.view().data());
+    EXPECT_EQ("TagTableTestLayer", first.view());
+    EXPECT_FALSE(first == other);
+}
+
+TEST(TagTableTest, EmptyTag)
+{
+    const FileParse::Tag empty;
+
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty, FileParse::Tag{""});
+    EXPECT_EQ("", empty.str());
+}
+
+TEST(TagTableTest, ConcurrentInterning)
+{
+    constexpr size_t threadCount{8u};
+    std::vector<FileParse::Tag> tags(threadCount);
+
+    std::vector<std::thread> threads;
+    for(size_t i = 0u; i < threadCount; ++i)
+    {
+        threads.emplace_back([&tags, i] { tags[i] = FileParse::Tag{"TagTableTestConcurrent"}; });
+    }
+    for(auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    for(const auto & tag : tags)
+    {
+        EXPECT_EQ(tags.front(), tag);
+    }
+}
+
+TEST(TagTableTest, RepeatedJSONNamesAreInternedOnce)
+{
+    const std::string json{R"({"Root": {"TagTableTestItem": [{"TagTableTestValue": "1"},
+                                                              {"TagTableTestValue": "2"},
+                                                              {"TagTableTestValue": "3"}]}})"};
+
+    const auto first{getJSONTopNodeFromString(json, "Root")};
+    ASSERT_TRUE(first.has_value());
+    const auto items{first->getChildNodesByName("TagTableTestItem")};
+    ASSERT_EQ(3u, items.size());
+    for(const auto & item : items)
+    {
+        EXPECT_EQ("TagTableTestItem", item.getCurrentTag());
+        EXPECT_EQ("TagTableTestValue", item.getChildNodes().front().getCurrentTag());
+    }
+
+    // Reading the same names again does not grow the table
+    const auto count{FileParse::internedTagCount()};
+    const auto second{getJSONTopNodeFromString(json, "Root")};
+    ASSERT_TRUE(second.has_value());
+    for(const auto & item : second->getChildNodes())
+    {
+        EXPECT_TRUE(item.hasChildNode("TagTableTestValue"));
+    }
+    EXPECT_EQ(count, FileParse::internedTagCount());
+}
+
+TEST(TagTableTest, JSONObjectKeysAreNotInterned)
+{
+    std::string json{R"({"Root": {)"};
+    for(size_t i = 0u; i < 100u; ++i)
+    {
+        json += (i == 0u ? "" : ",") + std::string{"\"TagTableTestKey"} + std::to_string(i)
+                + "\": " + std::to_string(i);
+    }
+    json += "}}";
+
+    const auto count{FileParse::internedTagCount()};
+    const auto node{getJSONTopNodeFromString(json, "Root")};
+    ASSERT_TRUE(node.has_value());
+    const auto children{node->getChildNodes()};
+    ASSERT_EQ(100u, children.size());
+    std::set<std::string> tags;
+    for(const auto & child : children)
+    {
+        tags.insert(child.getCurrentTag());
+    }
+    EXPECT_EQ(100u, tags.size());
+    EXPECT_EQ(1u, tags.count("TagTableTestKey42"));
+
+    // Looking children up by name views the keys of the document as well
+    const auto child{node->getFirstChildByName("TagTableTestKey7")};
+    ASSERT_TRUE(child.has_value());
+    EXPECT_EQ("TagTableTestKey7", child->getCurrentTag());
+    EXPECT_EQ(1u, node->getChildNodesByName("TagTableTestKey8").size());
+    EXPECT_EQ(count, FileParse::internedTagCount());
+}
@@ -0,0 +1,135 @@
+/// Loading with structured errors carrying the failure position (XML and JSON)
+#include <filesystem>
+#include <gtest/gtest.h>
+
+#include "include/fileParse/FileDataHandler.hxx"
+
+#include "test/helper/serializers/SerializersBaseElement.hxx"
+#include "test/helper/structures/StructureBase.hxx"
+
+using FileParse::ErrorCategory;
+
+TEST(TryLoadTest, ValidStrings)
+{
+    const auto xml{Common::tryLoadFromString<Helper::BaseElement>(
+      "<Root><SampleText>Text</SampleText><Integer>4</Integer></Root>", "Root")};
+    ASSERT_TRUE(xml.has_value());
+    EXPECT_EQ("Text", xml->text);
+    EXPECT_EQ(4, xml.value().integer_number);
+
+    const auto json{Common::tryLoadFromString<Helper::BaseElement>(
+      R"({"Root": {"SampleText": "Text", "Integer": "4"}})", "Root")};
+    ASSERT_TRUE(json.has_value());
+    EXPECT_EQ("Text", json->text);
+    EXPECT_EQ(4, json->integer_number);
+}
+
+TEST(TryLoadTest, JSONSyntaxError)
+{
+    const std::string json{"{\n  \"Root\": {\n    \"SampleText\": tru\n  }\n}"};
+    const auto result{Common::tryLoadFromJSONString<Helper::BaseElement>(json, "Root")};
+
+    ASSERT_FALSE(result);
+    const auto & error{result.error()};
+    EXPECT_EQ(ErrorCategory::Syntax, error.category);
+    EXPECT_EQ(3u, error.line);
+    EXPECT_EQ(json.find("tru") + 3u, error.offset);
+    EXPECT_EQ(error.offset - json.rfind('\n', error.offset - 1u), error.column);
+    EXPECT_EQ("Root/SampleText", error.nodePath);
+    EXPECT_FALSE(error.message.empty());
+}
+
+TEST(TryLoadTest, XMLSyntaxError)
+{
+    const std::string xml{"<Root>\n<SampleText>Text</SampleText>\n"};
+    const auto result{Common::tryLoadFromXMLString<Helper::BaseElement>(xml, "Root")};
+
+    ASSERT_FALSE(result);
+    const auto & error{result.error()};
+    EXPECT_EQ(ErrorCategory::Syntax, error.category);
+    EXPECT_GE(error.line, 2u);
+    EXPECT_GE(error.column, 1u);
+    EXPECT_LE(error.offset, xml.size());
+}
+
+TEST(TryLoadTest, MissingNode)
+{
+    for(const auto * data : {R"({"Other": {}})", "<Other></Other>"})
+    {
+        const auto result{Common::tryLoadFromString<Helper::BaseElement>(data, "Root")};
+        ASSERT_FALSE(result);
+        EXPECT_EQ(ErrorCategory::MissingNode, result.error().category);
+        EXPECT_EQ("Root", result.error().nodePath);
+    }
+}
+
+TEST(TryLoadTest, DecodeError)
+{
+    const auto result{Common::tryLoadFromXMLString<Helper::BaseElement>(
+      "<Root><Double>abc</Double></Root>", "Root")};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(ErrorCategory::Decode, result.error().category);
+    EXPECT_EQ("Root/Double", result.error().nodePath);
+    EXPECT_THROW(static_cast<void>(result.value()), std::runtime_error);
+}
+
+TEST(TryLoadTest, DecodeErrorPathIsReset)
+{
+    const auto failed{Common::tryLoadFromJSONString<Helper::BaseElement>(
+      R"({"Root": {"Integer": "abc"}})", "Root")};
+    ASSERT_FALSE(failed);
+    EXPECT_EQ("Root/Integer", failed.error().nodePath);
+    EXPECT_TRUE(FileParse::Detail::currentNodePath().empty());
+
+    const auto loaded{Common::tryLoadFromJSONString<Helper::BaseElement>(
+      R"({"Root": {"Integer": "4"}})", "Root")};
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(4, loaded->integer_number);
+}
+
+TEST(TryLoadTest, UnknownFormat)
+{
+    const auto result{Common::tryLoadFromString<Helper::BaseElement>("Root", "Root")};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(ErrorCategory::UnknownFormat, result.error().category);
+    EXPECT_EQ("UnknownFormat", FileParse::toString(result.error().category));
+}
+
+TEST(TryLoadTest, Files)
+{
+    const auto directory{std::filesystem::temp_directory_path()};
+    const auto missing{(directory / "TryLoadMissing.json").string()};
+
+    const auto result{Common::tryLoadFromFile<Helper::BaseElement>(missing, "Root")};
+    ASSERT_FALSE(result);
+    EXPECT_EQ(ErrorCategory::FileNotFound, result.error().category);
+    EXPECT_FALSE(std::filesystem::exists(missing));
+
+    Helper::BaseElement element;
+    element.text = "Saved";
+    for(const auto * name : {"TryLoad.xml", "TryLoad.json"})
+    {
+        const auto fileName{(directory / name).string()};
+        ASSERT_EQ(0, Common::saveToFile(element, fileName, "Root"));
+
+        const auto loaded{Common::tryLoadFromFile<Helper::BaseElement>(fileName, "Root")};
+        ASSERT_TRUE(loaded);
+        EXPECT_EQ("Saved", loaded->text);
+        std::filesystem::remove(fileName);
+    }
+}
+
+TEST(TryLoadTest, LineAndColumn)
+{
+    FileParse::LoadError error;
+    error.offset = 7u;
+    FileParse::setLineAndColumn(error, "ab\ncd\nef");
+    EXPECT_EQ(3u, error.line);
+    EXPECT_EQ(2u, error.column);
+
+    error.offset = 0u;
+    FileParse::setOffset(error, "ab\ncd\nef");
+    EXPECT_EQ(7u, error.offset);
+}
@@ -115,6 +115,19 @@ TEST(XMLNodeAdapterEdgeCases, NChildNode)
     EXPECT_EQ(0, node.nChildNode("NonExistent"));
 }
 
+TEST(XMLNodeAdapterEdgeCases, CountChildren)
+{
+    auto node = createXMLTopNode("TestRoot");
+    [[maybe_unused]] auto c1 = node.addChild("Item");
+    [[maybe_unused]] auto c2 = node.addChild("Other");
+    [[maybe_unused]] auto c3 = node.addChild("Item");
+
+    EXPECT_EQ(2u, node.countChildren("Item"));
+    EXPECT_EQ(1u, node.countChildren("Other"));
+    EXPECT_EQ(0u, node.countChildren("NonExistent"));
+    EXPECT_EQ(2u, node.getChildNodesByName("Item").size());
+}
+
 TEST(XMLNodeAdapterEdgeCases, HasChildNode)
 {
     auto node = createXMLTopNode("TestRoot");